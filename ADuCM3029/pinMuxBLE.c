@@ -11,13 +11,13 @@
  **
  ** Selected Peripherals
  ** --------------------
- ** SPI0 (SCLK, MOSI, MISO, CS_0)
+ ** SPI0 (SCLK, MOSI, MISO, CS_0, RDY)
  ** I2C0 (SCL0, SDA0)
  ** UART0 (Tx, Rx)
  **
  ** GPIO (unavailable)
  ** ------------------
- ** P0_00, P0_01, P0_02, P0_03, P0_04, P0_05, P0_10, P0_11
+ ** P0_00, P0_01, P0_02, P0_03, P0_04, P0_05, P0_10, P0_11, P1_14
  */
 
 #include <sys/platform.h>
@@ -31,6 +31,7 @@
 #define I2C0_SDA0_PORTP0_MUX  ((uint16_t) ((uint16_t) 1<<10))
 #define UART0_TX_PORTP0_MUX  ((uint32_t) ((uint32_t) 1<<20))
 #define UART0_RX_PORTP0_MUX  ((uint32_t) ((uint32_t) 1<<22))
+#define SPI0_RDY_PORTP1_MUX  ((uint32_t) ((uint32_t) 1<<28))
 
 int32_t adi_initpinmux(void);
 
@@ -42,6 +43,7 @@ int32_t adi_initpinmux(void) {
     *((volatile uint32_t *)REG_GPIO0_CFG) = SPI0_SCLK_PORTP0_MUX | SPI0_MOSI_PORTP0_MUX
      | SPI0_MISO_PORTP0_MUX | SPI0_CS_0_PORTP0_MUX | I2C0_SCL0_PORTP0_MUX
      | I2C0_SDA0_PORTP0_MUX | UART0_TX_PORTP0_MUX | UART0_RX_PORTP0_MUX;
+    *((volatile uint32_t *)REG_GPIO1_CFG) = SPI0_RDY_PORTP1_MUX;
 
     return 0;
 }
@@ -2,11 +2,13 @@
 #include "BLE_Module.h"
 #include "system.h"
 #include "Communications.h"
+#include "ram_arena.h"
+#include <assert.h>
 
 #define SPI_CS_NUM      ADI_SPI_CS0
 
 
-static uint8_t dummy_rx[SPI_MAX_LENGTH];    //Provisional, try to use drivers to transmit without receiving
+static uint8_t *dummy_rx = NULL;    //Provisional, try to use drivers to transmit without receiving. Boot phase arena buffer
 
 extern void Delay_ms(unsigned int mSec);//delay function
 
@@ -19,6 +21,7 @@ extern void Delay_ms(unsigned int mSec);//delay function
 *                uint32_t length = file length in bytes                                                                   
 * Return Value : crc = check value
 **********************************************************************************************/
+ADI_ISRAM_CODE
 uint8_t calc_crc(uint8_t const* bin, uint32_t length)
 {
   uint32_t i;
@@ -112,6 +115,8 @@ uint8_t send_payload(uint8_t const* bin, uint32_t length)
   uint32_t module = length%SPI_MAX_LENGTH; //check if length matches spi memory length exactly
   
   
+  ARENA_CHECK(ARENA_PHASE_BOOT);
+  
   //send payload
   for(uint32_t i = 0 ; i < iterations ; i++)
   {
@@ -159,6 +164,12 @@ uint32_t Ble_Spi_Boot(uint8_t const * bin, uint32_t length)
   adi_gpio_SetHigh(BLE_LED_PORT, BLE_LED_PIN);
   adi_gpio_OutputEnable(BLE_RST_PORT, BLE_RST_PIN, true);//BLE Reset Pin
   
+  //SPI receive staging, only needed until the BLE module is booted
+  if(dummy_rx == NULL)
+    dummy_rx = Arena_Alloc(ARENA_PHASE_BOOT, SPI_MAX_LENGTH);
+  if(dummy_rx == NULL)
+      return 1;
+  
   //Initialize SPI
   if(Spi_Init() != 0)
       return 1;
@@ -2,21 +2,37 @@
 
 #include <drivers/uart/adi_uart.h>
 #include <drivers/spi/adi_spi.h>
+#include <services/pwr/adi_pwr.h>
+#include <string.h>
 
 #include "Communications.h"
+#include "packetizer.h"
+#include "spsc_ring.h"
+#include "ram_arena.h"
+#include "clock_governor.h"
+#include "idle_manager.h"
 
 uint8_t                 UartDeviceMem[UART_MEMORY_SIZE];//UART memory size
 ADI_UART_HANDLE         hUartDevice;//UART device handle
 unsigned char 	        RxBuffer[];//UART receive buffer
 ADI_UART_RESULT         eUartResult;//UART error variable
-bool data_sent =        false;//UART data_sent flag
-bool data_received =    false;//UART data_recieved flag
+static uint32_t        *UartEventMem = NULL;//UART callback events, run phase arena buffer
+static SPSC_RING        UartEvents;//UART callback to application event ring
+static CMD_PARSER      *pUartParser = NULL;//stream receive parser, NULL when not streaming
+static uint8_t          UartStreamBuffers[2][UART_STREAM_BUFFER_SIZE];//stream receive double buffer
+static uint32_t        *UartMsgMem = NULL;//UART_MSG_BLOCKS message blocks, run phase arena buffer
+static BLOCK_POOL       UartMsgPool;//messages filled in place, freed by UARTCallback once sent
+static uint32_t         UartMsgSubmitted;//message blocks given to the driver, main loop only
+static volatile uint32_t UartMsgSent;//message blocks the driver is done with, UARTCallback only
+static bool_t           bUartIdleHold = false;//IDLE_MODE_FLEXI held for the open UART
 
 
 ADI_SPI_RESULT          eSpiResult; //SPI error variable
 static ADI_SPI_HANDLE   hSPIDevice; //SPI handle
 static uint8_t          SPIMem[ADI_SPI_MEMORY_SIZE];//SPI memory size
 static ADI_SPI_TRANSCEIVER transceive;//transceive struct for SPI Read/Writes
+static uint32_t         SpiBitrate = SPI_BITRATE;//SPI clock rate last set, kept across clock changes
+static bool_t           bClockListener = false;//CommsClockChange registered with the clock governor
 
 
 /********************************************************************
@@ -29,14 +45,28 @@ void UARTCallback( void *pAppHandle, uint32_t nEvent, void *pArg)
     {
         //CASE (TxBuffer has been cleared, Data sent) 
         case ADI_UART_EVENT_TX_BUFFER_PROCESSED:
+                //message block sent, give it back. The driver pauses by itself when nothing is queued
+                if(BlockPool_Owns(&UartMsgPool, pArg))
+                {
+                  BlockPool_Free(&UartMsgPool, pArg);
+                  UartMsgSent++;
+                  break;
+                }
                 adi_uart_EnableTx(hUartDevice, false);//disable tx buffer
-                data_sent = true;
+                SpscRing_Push(&UartEvents, &nEvent);
                 break;
                 
         //CASE (RxBuffer has been cleared, Data recieved) 
         case ADI_UART_EVENT_RX_BUFFER_PROCESSED:
+                //stream mode, parse in place and queue the buffer again behind the other one
+                if(pUartParser != NULL)
+                {
+                  CmdParser_Feed(pUartParser, (uint8_t const *)pArg, UART_STREAM_BUFFER_SIZE);
+                  adi_uart_SubmitRxBuffer(hUartDevice, pArg, UART_STREAM_BUFFER_SIZE);
+                  break;
+                }
                 adi_uart_EnableRx(hUartDevice, false);//disable rx buffer
-                data_received = true;
+                SpscRing_Push(&UartEvents, &nEvent);
                 break;
                 
     default: break;
@@ -44,6 +74,82 @@ void UARTCallback( void *pAppHandle, uint32_t nEvent, void *pArg)
 }
 
 
+/********************************************************************
+* Wait for a UART callback event, other events are dropped           *
+*********************************************************************/
+static void Uart_WaitEvent(uint32_t _event)
+{
+  uint32_t event = 0u;
+  
+  while(event != _event)
+  {
+    while(SpscRing_Pop(&UartEvents, &event) != 0)
+    {
+      Delay_ms(10);
+    }
+  }
+}
+
+
+/********************************************************************
+* Program the UART divisors for a baud rate at the current PCLK      *
+*********************************************************************/
+static ADI_UART_RESULT UartSetBaudRate(uint32_t _baud)
+{
+  uint32_t pclk;
+  uint32_t divC, ratio;
+
+  if(adi_pwr_GetClockFrequency(ADI_CLOCK_PCLK, &pclk) != ADI_PWR_SUCCESS)
+    return ADI_UART_FAILED;
+
+  //baud = PCLK / (2^(OSR+2) * DIV-C * (DIV-M + DIV-N/2048)), DIV-C picked so that
+  //DIV-M + DIV-N/2048 lands in 2 to 4. Same values as the table at 26MHz
+  divC = (pclk / (16u * _baud)) / 2u;
+  if(divC == 0u)
+    divC = 1u;
+  ratio = ((pclk * 128u) + ((_baud * divC) / 2u)) / (_baud * divC);
+  if((ratio >> 11) > 3u)
+    ratio = (3u << 11) | 2047u;
+
+  return adi_uart_ConfigBaudRate(hUartDevice, (uint16_t)divC, (uint8_t)(ratio >> 11),
+                                 (uint16_t)(ratio & 2047u), UART_OSR);
+}
+
+
+/********************************************************************
+* Clock governor listener, the UART and SPI follow PCLK              *
+*********************************************************************/
+static void CommsClockChange(void *pCBParam, uint32_t Event, void *pArg)
+{
+  if(Event == CLOCK_GOV_EVENT_PRE_CHANGE)
+  {
+    //a byte on the line would be garbled, let the transmit queue drain.
+    //A host byte arriving meanwhile may be lost, the transport resends
+    if(hUartDevice != NULL)
+    {
+      while(UartMsgSent != UartMsgSubmitted)
+      {
+      }
+      while((pADI_UART0->COMLSR & BITM_UART_COMLSR_TEMT) == 0u)
+      {
+      }
+    }
+    return;
+  }
+
+  if(hUartDevice != NULL)
+    eUartResult = UartSetBaudRate(UART_BAUDRATE);
+  if(hSPIDevice != NULL)
+    eSpiResult = adi_spi_SetBitrate(hSPIDevice, SpiBitrate);
+}
+
+static void RegisterClockListener(void)
+{
+  if(!bClockListener)
+    bClockListener = (bool_t)(ClockGov_Register(CommsClockChange, NULL) == 0);
+}
+
+
 /**********************************************************************************************
 * Function Name: UART_Init                                                                   
 * Description  : This function initializes an instance of the UART driver for UART_DEVICE_NUM 
@@ -70,20 +176,35 @@ unsigned char Uart_Init(void)
   if(eUartResult != ADI_UART_SUCCESS)
     return 1;
   
-  //set baud rate at 115200
-  eUartResult = adi_uart_ConfigBaudRate(hUartDevice,
-                          UART_DIV_C_115200,
-                          UART_DIV_M_115200,
-                          UART_DIV_N_115200,
-                          UART_OSR_115200);
+  //set baud rate at UART_BAUDRATE, the divisors follow the clock governor
+  eUartResult = UartSetBaudRate(UART_BAUDRATE);
+  RegisterClockListener();
+	
+  //callback event ring and transmit queue share the arena with the boot buffers
+  if(UartEventMem == NULL)
+    UartEventMem = Arena_Alloc(ARENA_PHASE_RUN, UART_EVENT_RING_SIZE * sizeof(uint32_t));
+  if(UartMsgMem == NULL)
+    UartMsgMem = Arena_Alloc(ARENA_PHASE_RUN, BLOCK_POOL_STORAGE_SIZE(UART_MSG_BLOCK_SIZE, UART_MSG_BLOCKS));
+  if((UartEventMem == NULL) || (UartMsgMem == NULL))
+    return 1;
+  
+  //empty callback event ring, all message blocks free
+  SpscRing_Init(&UartEvents, UartEventMem, sizeof(uint32_t), UART_EVENT_RING_SIZE);
+  BlockPool_Init(&UartMsgPool, "uart msg", UartMsgMem, UART_MSG_BLOCK_SIZE, UART_MSG_BLOCKS);
+  UartMsgSubmitted = 0u;
+  UartMsgSent = 0u;
 	
 	//register callback
   adi_uart_RegisterCallback(hUartDevice,UARTCallback,hUartDevice);
 		
   if(eUartResult != ADI_UART_SUCCESS)
     return 1;
-  else
-    return 0;
+  
+  //reception and the DMA transmit queue need PCLK, no hibernate while open.
+  //Taken last so a failed init leaves no hold behind
+  if(!bUartIdleHold)
+    bUartIdleHold = (bool_t)(Idle_Hold(IDLE_MODE_FLEXI) == 0);
+  return 0;
 }
 
 
@@ -100,8 +221,14 @@ unsigned char Uart_Close(void)
   eUartResult = adi_uart_Close(hUartDevice);
   if(eUartResult != ADI_UART_SUCCESS)
     return 1;
-  else
-    return 0;
+  
+  hUartDevice = NULL;
+  if(bUartIdleHold)
+  {
+    Idle_Release(IDLE_MODE_FLEXI);
+    bUartIdleHold = false;
+  }
+  return 0;
 }
 
 
@@ -109,16 +236,15 @@ unsigned char Uart_Close(void)
 * Function Name: UART_ReadWrite                                                                   
 * Description  : This function parses a string to the TxBuffer, submits it and submits an 
 *                empty RxBuffer before enabling the dataflow for both buffers.
-*                data_recieved/sent flag set by callback
+*                completion events pushed by callback
 * Arguments    : char* string = string to be sent                                                                       
 * Return Value : 0 = Success                                                                    
 *                1 = Failure (See eUartResult in debug mode for adi micro specific info)     
 **********************************************************************************************/
 unsigned char Uart_ReadWrite(char *TxBuffer)
 {
-  //clear flags
-  data_sent = false;
-  data_received = false;
+  //drop stale events
+  SpscRing_Flush(&UartEvents);
   
   //ensure data transfer is disabled for submitting buffers
   eUartResult = adi_uart_EnableRx(hUartDevice,false);
@@ -158,10 +284,7 @@ unsigned char Uart_ReadWrite(char *TxBuffer)
   
   else
     //wait for data sent
-    while(data_sent == false)
-    {
-      Delay_ms(10);
-    }
+    Uart_WaitEvent(ADI_UART_EVENT_TX_BUFFER_PROCESSED);
   
     return 0;
 }
@@ -170,15 +293,15 @@ unsigned char Uart_ReadWrite(char *TxBuffer)
 /**********************************************************************************************
 * Function Name: UART_Read                                                                  
 * Description  : This function submits an empty RxBuffer before enabling the dataflow for the receive
-*                buffer. data_recieved flag set by callback
+*                buffer. completion event pushed by callback
 * Arguments    : void                                                                         
 * Return Value : 0 = Success                                                                    
 *                1 = Failure (See eUartResult in debug mode for adi micro specific info)     
 **********************************************************************************************/
 unsigned char Uart_Read(void)
 {
-  //clear flag
-  data_received = false;
+  //drop stale events
+  SpscRing_Flush(&UartEvents);
   
   //ensure data transfer is disabled for submitting buffers
   eUartResult = adi_uart_EnableRx(hUartDevice,false);
@@ -200,11 +323,8 @@ unsigned char Uart_Read(void)
   
   else
     
-    //wait for data sent
-    while(data_received == false)
-    {
-      Delay_ms(10);
-    }
+    //wait for data received
+    Uart_WaitEvent(ADI_UART_EVENT_RX_BUFFER_PROCESSED);
   
     return 0;
 }
@@ -212,28 +332,39 @@ unsigned char Uart_Read(void)
 
 /**********************************************************************************************
 * Function Name: UART_Write                                                                   
-* Description  : This function parses a string to the TxBuffer, submits it before 
-*                enabling the dataflow for the transfer buffers. data_sent flag set by callback
+* Description  : This function sends a null terminated string, see Uart_WriteBuffer
 * Arguments    : char* string = string to be sent                                                                        
 * Return Value : 0 = Success                                                                    
 *                1 = Failure (See eUartResult in debug mode for adi micro specific info)     
 **********************************************************************************************/
 unsigned char Uart_Write(char* TxBuffer)
 {
-  //clear flag
-  data_sent = false;
+  return Uart_WriteBuffer((uint8_t const *)TxBuffer, (uint16_t)strlen(TxBuffer));
+}
+
+
+/**********************************************************************************************
+* Function Name: UART_WriteBuffer                                                                   
+* Description  : This function submits _length bytes of _array before enabling the dataflow 
+*                for the transfer buffers and waits until they are sent. Completion event
+*                pushed by callback
+* Arguments    : uint8_t const* _array = bytes to be sent, may contain zeros
+*                uint16_t _length = number of bytes
+* Return Value : 0 = Success                                                                    
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Uart_WriteBuffer(uint8_t const * _array, uint16_t _length)
+{
+  //drop stale events
+  SpscRing_Flush(&UartEvents);
   
   //ensure data transfer is disabled for submitting buffers
   eUartResult = adi_uart_EnableTx(hUartDevice,false); 
   if(eUartResult != ADI_UART_SUCCESS)
     return 1;
   
-  //length of string
-  int16_t size_l = 0; 
-  size_l = strlen(TxBuffer);
-  
-  //submit TxBuffer for sending data
-  eUartResult = adi_uart_SubmitTxBuffer(hUartDevice, TxBuffer, size_l);
+  //submit the bytes for sending data
+  eUartResult = adi_uart_SubmitTxBuffer(hUartDevice, (void *)_array, _length);
   if(eUartResult != ADI_UART_SUCCESS)
     return 1;
   
@@ -245,15 +376,152 @@ unsigned char Uart_Write(char* TxBuffer)
   else
     
     //wait for data sent
-    while(data_sent == false)
-    {
-      Delay_ms(10);
-    }
+    Uart_WaitEvent(ADI_UART_EVENT_TX_BUFFER_PROCESSED);
   
     return 0;
 }
 
 
+/**********************************************************************************************
+* Function Name: UART_AllocMessage                                                                   
+* Description  : This function takes a free message block of UART_MSG_BLOCK_SIZE bytes for the
+*                caller to fill in place and pass to Uart_SendMessage. While all blocks are
+*                filled or being sent it waits in Idle_Wait for UARTCallback to free one, at
+*                most _waitMs. Main loop only when _waitMs is not 0.
+* Arguments    : uint32_t _waitMs = longest wait in ms, 0 = do not wait
+* Return Value : message block, NULL when none came free in time
+**********************************************************************************************/
+void* Uart_AllocMessage(uint32_t _waitMs)
+{
+  void *pBlock = BlockPool_Alloc(&UartMsgPool);
+  uint32_t end = ClockGov_Cycles() + (_waitMs * (CLOCK_GOV_ROOT_HZ / 1000u));
+  bool_t woken = false;
+
+  while((pBlock == NULL) && (ClockGov_MsUntil(end) > 0u))
+  {
+    if(Idle_Wait(1u) != 0)
+      woken = true;
+    pBlock = BlockPool_Alloc(&UartMsgPool);
+  }
+
+  //an Idle_Wake meant for the caller's own wait is passed on
+  if(woken)
+    Idle_Wake();
+  return pBlock;
+}
+
+
+/**********************************************************************************************
+* Function Name: UART_SendMessage                                                                   
+* Description  : This function queues a message block for sending without copying it and 
+*                returns without waiting for the bytes to go out. The block belongs to the UART
+*                from here on, UARTCallback frees it once sent and this call frees it if the
+*                driver refuses it or stays busy. Only waits while the driver already holds
+*                UART_TX_IN_FLIGHT buffers, at most UART_MSG_WAIT_MS. Main loop only.
+* Arguments    : void* _block = block from Uart_AllocMessage
+*                uint16_t _length = bytes to send, at most UART_MSG_BLOCK_SIZE
+* Return Value : 0 = Success
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Uart_SendMessage(void *_block, uint16_t _length)
+{
+  uint32_t end = ClockGov_Cycles() + (UART_MSG_WAIT_MS * (CLOCK_GOV_ROOT_HZ / 1000u));
+  bool_t woken = false;
+
+  //wait for room in the driver queue
+  while(((UartMsgSubmitted - UartMsgSent) >= UART_TX_IN_FLIGHT) && (ClockGov_MsUntil(end) > 0u))
+  {
+    if(Idle_Wait(1u) != 0)
+      woken = true;
+  }
+
+  //an Idle_Wake meant for the caller's own wait is passed on
+  if(woken)
+    Idle_Wake();
+
+  if((UartMsgSubmitted - UartMsgSent) >= UART_TX_IN_FLIGHT)
+  {
+    //the transmitter is stuck, the block is dropped rather than the caller
+    BlockPool_Free(&UartMsgPool, _block);
+    return 1;
+  }
+  
+  UartMsgSubmitted++;
+  eUartResult = adi_uart_SubmitTxBuffer(hUartDevice, _block, (uint32_t)_length);
+  if(eUartResult != ADI_UART_SUCCESS)
+  {
+    //the driver never saw the block, so it is freed here
+    UartMsgSubmitted--;
+    BlockPool_Free(&UartMsgPool, _block);
+    return 1;
+  }
+  
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: UART_FreeMessage                                                                   
+* Description  : This function gives back a message block that was not passed to 
+*                Uart_SendMessage
+* Arguments    : void* _block = block from Uart_AllocMessage
+* Return Value : void
+**********************************************************************************************/
+void Uart_FreeMessage(void *_block)
+{
+  BlockPool_Free(&UartMsgPool, _block);
+}
+
+
+/**********************************************************************************************
+* Function Name: UART_GetMessagePool                                                                   
+* Description  : This function returns the message block pool for its use counters
+* Arguments    : void
+* Return Value : message block pool
+**********************************************************************************************/
+BLOCK_POOL const* Uart_GetMessagePool(void)
+{
+  return &UartMsgPool;
+}
+
+
+/**********************************************************************************************
+* Function Name: UART_ReceiveStream                                                                   
+* Description  : This function starts continuous reception into a double buffer. Each received
+*                buffer is fed to _parser from the UART interrupt, so complete command frames 
+*                are dispatched as soon as their last byte arrives. Uart_Read and 
+*                Uart_ReadWrite must not be used while streaming.
+* Arguments    : CMD_PARSER* _parser = parser initialised by CmdParser_Init                                                                         
+* Return Value : 0 = Success                                                                    
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Uart_ReceiveStream(CMD_PARSER *_parser)
+{
+  uint32_t i;
+  
+  //ensure data transfer is disabled for submitting buffers
+  eUartResult = adi_uart_EnableRx(hUartDevice,false);
+  if(eUartResult != ADI_UART_SUCCESS)
+    return 1;
+  
+  pUartParser = _parser;
+  
+  //keep both buffers queued so there is always one to receive into
+  for(i = 0; i < 2u; i++)
+  {
+    eUartResult = adi_uart_SubmitRxBuffer(hUartDevice, UartStreamBuffers[i], UART_STREAM_BUFFER_SIZE);
+    if(eUartResult != ADI_UART_SUCCESS)
+      return 1;
+  }
+  
+  eUartResult = adi_uart_EnableRx(hUartDevice,true);
+  if(eUartResult != ADI_UART_SUCCESS)
+    return 1;
+  
+  return 0;
+}
+
+
 /**********************************************************************************************
 * Function Name: Spi_Init                                                                   
 * Description  : This function initializes SPI and creates a handle which is configured accordingly
@@ -268,9 +536,11 @@ unsigned char Spi_Init(void)
     return 1;
   
   //Set the SPI clock rate 
+  SpiBitrate = SPI_BITRATE;
   eSpiResult = adi_spi_SetBitrate(hSPIDevice,SPI_BITRATE);
   if(eSpiResult != ADI_SPI_SUCCESS)
     return 1;
+  RegisterClockListener();
   
   //Set the chip select 
   eSpiResult = adi_spi_SetChipSelect(hSPIDevice, SPI_CS_NUM);
@@ -305,8 +575,8 @@ unsigned char Spi_Close(void)
   if(eSpiResult != ADI_SPI_SUCCESS)
     return 1;
 
-  else
-    return 0;
+  hSPIDevice = NULL;
+  return 0;
 }
 
 
@@ -385,3 +655,199 @@ unsigned char Spi_Write(uint8_t const * TxArray, uint8_t TxLength)
    else
     return 0;
 }
+
+
+/**********************************************************************************************
+* Function Name: Spi_SetBitrate                                                                   
+* Description  : This function changes the SPI clock rate of the existing SPI handle
+* Arguments    : uint32_t bitrate = SPI clock rate (Hz)                                                                       
+* Return Value : 0 = Success                                                                    
+*                1 = Failure (See eSpiResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Spi_SetBitrate(uint32_t bitrate)
+{
+  eSpiResult = adi_spi_SetBitrate(hSPIDevice, bitrate);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+
+  SpiBitrate = bitrate;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Spi_SetFlowControl                                                                   
+* Description  : This function configures hardware flow control for SPI reads. With 
+*                ADI_SPI_FLOW_MODE_RDY the master clocks burstSize bytes and then waits for the 
+*                slave to assert RDY before the next burst. With ADI_SPI_FLOW_MODE_TIMER the master
+*                waits waitTime SCLK cycles between bursts instead. ADI_SPI_FLOW_MODE_NONE restores
+*                free running transfers. RDY is SPI_FLOW_RDY_PIN, muxed by adi_initpinmux.
+* Arguments    : ADI_SPI_FLOW_MODE mode = flow control mode
+*                uint8_t burstSize = bytes received per burst (1-16)
+*                uint16_t waitTime = SCLK cycles to wait between bursts (timer mode only)
+*                bool_t rdyActiveLow = true: wait for RDY low, false: wait for RDY high                                                                   
+* Return Value : 0 = Success                                                                    
+*                1 = Failure (See eSpiResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Spi_SetFlowControl(ADI_SPI_FLOW_MODE mode, uint8_t burstSize, uint16_t waitTime, bool_t rdyActiveLow)
+{
+  //burst size register holds size-1
+  if((burstSize == 0) || (burstSize > 16))
+    return 1;
+  
+  //disable flow control while reconfiguring
+  eSpiResult = adi_spi_SetFlowMode(hSPIDevice, ADI_SPI_FLOW_MODE_NONE);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  if(mode == ADI_SPI_FLOW_MODE_NONE)
+    return 0;
+  
+  eSpiResult = adi_spi_SetBurstSize(hSPIDevice, burstSize - 1);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  eSpiResult = adi_spi_WaitTime(hSPIDevice, waitTime);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  eSpiResult = adi_spi_SetReadySignalPolarity(hSPIDevice, rdyActiveLow);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  //enable flow control last so the first burst uses the new settings
+  eSpiResult = adi_spi_SetFlowMode(hSPIDevice, mode);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  else
+    return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Spi_ReadWriteFlow                                                                   
+* Description  : This function performs a Spi_ReadWrite at the fastest SPI clock PCLK allows at
+*                CLOCK_GOV_LEVEL_HIGH, with RDY-gated bursts of SPI_FLOW_BURST_SIZE bytes, so the
+*                slave only slows the master down when it actually needs to. Flow control and the
+*                previous SPI clock rate are restored afterwards.
+* Arguments    : uint8_t const* TxArray = Transmit Array
+*                uint16_t TxLength = Transmit length (bytes)
+*                uint8_t* RxArray = Receive Array
+*                uint16_t RxLength = Recieve length (bytes)                                                                   
+* Return Value : 0 = Success                                                                    
+*                1 = Failure (See eSpiResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Spi_ReadWriteFlow(uint8_t const* TxArray, uint16_t TxLength, uint8_t* RxArray, uint16_t RxLength)
+{
+  uint32_t bitrate = SpiBitrate;
+  uint32_t pclk;
+  unsigned char result = 1;
+  
+  if(ClockGov_Hold(CLOCK_GOV_LEVEL_HIGH) != 0)
+    return 1;
+  
+  //just under PCLK/2, the smallest divider adi_spi_SetBitrate accepts
+  if((adi_pwr_GetClockFrequency(ADI_CLOCK_PCLK, &pclk) == ADI_PWR_SUCCESS) &&
+     (Spi_SetBitrate((pclk / 2u) - 1u) == 0) &&
+     (Spi_SetFlowControl(ADI_SPI_FLOW_MODE_RDY, SPI_FLOW_BURST_SIZE,
+                         SPI_FLOW_WAIT_TIME, SPI_FLOW_RDY_ACTIVE_LOW) == 0))
+  {
+    result = Spi_ReadWrite(TxArray, TxLength, RxArray, RxLength);
+  }
+  
+  //back to free running transfers at the previous clock
+  if(Spi_SetFlowControl(ADI_SPI_FLOW_MODE_NONE, SPI_FLOW_BURST_SIZE,
+                        SPI_FLOW_WAIT_TIME, SPI_FLOW_RDY_ACTIVE_LOW) != 0)
+    result = 1;
+  
+  if(Spi_SetBitrate(bitrate) != 0)
+    result = 1;
+  
+  if(ClockGov_Release(CLOCK_GOV_LEVEL_HIGH) != 0)
+    result = 1;
+  
+  return result;
+}
+
+
+/**********************************************************************************************
+* Function Name: Spi_GetHandle                                                                   
+* Description  : This function returns the SPI handle opened by Spi_Init, for drivers of devices
+*                on the same bus that read through Spi_ReadRegister
+* Arguments    : void                                                                   
+* Return Value : SPI handle, NULL when the SPI is closed
+**********************************************************************************************/
+ADI_SPI_HANDLE Spi_GetHandle(void)
+{
+  return hSPIDevice;
+}
+
+
+/**********************************************************************************************
+* Function Name: Spi_ReadRegister                                                                   
+* Description  : This function sends a command (e.g. read opcode + register address) and clocks
+*                in the response in the same CS frame using the controller's read-command mode.
+*                The controller switches from the command phase to the data phase by itself, so
+*                the CPU is not involved between the two. The controller counts the longer of the
+*                two phases, so responses shorter than the command are received into a local 
+*                buffer and copied out.
+* Arguments    : uint8_t const* Command = command bytes
+*                uint8_t CommandLength = command length (1-SPI_MAX_COMMAND_LENGTH bytes)
+*                uint8_t* RxArray = Receive Array
+*                uint16_t RxLength = Recieve length (bytes)                                                                   
+* Return Value : 0 = Success                                                                    
+*                1 = Failure (See eSpiResult in debug mode for adi micro specific info)     
+**********************************************************************************************/
+unsigned char Spi_ReadRegister(uint8_t const* Command, uint8_t CommandLength, uint8_t* RxArray, uint16_t RxLength)
+{
+  uint8_t short_rx[SPI_MAX_COMMAND_LENGTH];//Rx buffer for responses shorter than the command
+  unsigned char result = 0;
+  
+  if((CommandLength == 0) || (CommandLength > SPI_MAX_COMMAND_LENGTH) || (RxLength == 0))
+    return 1;
+  
+  //read-command transfers are short, run them from the interrupt handler
+  eSpiResult = adi_spi_EnableDmaMode(hSPIDevice, false);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  //number of bytes to transmit before reading (register holds length-1)
+  eSpiResult = adi_spi_SetTransmitBytes(hSPIDevice, CommandLength - 1);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  eSpiResult = adi_spi_SetReadCommand(hSPIDevice, true);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    return 1;
+  
+  //setup transceive struct with command and response buffers
+  transceive.TransmitterBytes = CommandLength;
+  transceive.nTxIncrement = true;
+  transceive.nRxIncrement = true;
+  transceive.pTransmitter = (uint8_t *)Command;
+  
+  if(RxLength < CommandLength)
+  {
+    transceive.ReceiverBytes = CommandLength;
+    transceive.pReceiver = short_rx;
+  }
+  else
+  {
+    transceive.ReceiverBytes = RxLength;
+    transceive.pReceiver = RxArray;
+  }
+  
+  //commit transceive struct to command read operation, a failed transfer leaves RxArray as it was
+  eSpiResult = adi_spi_ReadWrite(hSPIDevice,&transceive);
+  if(eSpiResult != ADI_SPI_SUCCESS)
+    result = 1;
+  else if(transceive.pReceiver == short_rx)
+    memcpy(RxArray, short_rx, RxLength);
+  
+  //back to plain full-duplex transfers, after a failed transfer too
+  if(adi_spi_SetReadCommand(hSPIDevice, false) != ADI_SPI_SUCCESS)
+    result = 1;
+  
+  return result;
+}
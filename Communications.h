@@ -7,6 +7,9 @@
 /******************************************************************************/
 
 #include "adi_types.h"
+#include <drivers/spi/adi_spi.h>
+#include "command_parser.h"
+#include "block_pool.h"
 
 
 /******************************************************************************/
@@ -17,14 +20,32 @@
 #define SPI_CS_NUM              ADI_SPI_CS0
 #define SPI_BITRATE             300000
 #define SPI_MAX_LENGTH          252      //MUST BE MULTIPLE OF 4
+#define SPI_MAX_COMMAND_LENGTH  16       //command bytes the controller sends in read-command mode
+
+/******************************************************************************/
+/* spi flow control parameters                                                */
+/******************************************************************************/
+
+#define SPI_FLOW_RDY_PIN        P1_14    //SPI0_RDY, mux function 1, routed by adi_initpinmux in pinMuxBLE.c
+#define SPI_FLOW_BURST_SIZE     8        //bytes read per burst before waiting on RDY (1-16)
+#define SPI_FLOW_WAIT_TIME      0        //SCLK cycles between bursts in timer mode (0 = 1 cycle)
+#define SPI_FLOW_RDY_ACTIVE_LOW true     //master waits until RDY is low
 
 /******************************************************************************/
 /* UART driver parameters                                                     */
 /******************************************************************************/
    
 #define UART_DEVICE_NUM         0
+#define UART_BAUDRATE           115200   //divisors derived from PCLK, again after every clock change
+#define UART_OSR                2        //16 samples per bit
 
 #define UART_MEMORY_SIZE    (ADI_UART_BIDIR_MEMORY_SIZE)
+#define UART_EVENT_RING_SIZE    4        //callback events queued for the application, MUST BE A POWER OF TWO
+#define UART_STREAM_BUFFER_SIZE 1        //bytes per stream receive buffer, frames are parsed as each one fills
+#define UART_MSG_BLOCKS         3        //message blocks, packetizer frames and Packetizer_Printf messages
+#define UART_MSG_BLOCK_SIZE     PKT_BLOCK_SIZE//bytes per message block, a packetizer frame or text frame, see packetizer.h
+#define UART_TX_IN_FLIGHT       2        //buffers the driver queues at once
+#define UART_MSG_WAIT_MS        100      //longest wait for a free message block, a full block goes out in about 2ms
 
 /*
                     Boudrate divider for PCLK-26000000
@@ -51,7 +72,7 @@
 
 
 */
-/* Select the boudrate divider for 57600 */
+/* Select the boudrate divider for 57600. Reference only, Uart_Init computes the divisors for the current PCLK */
 #define UART_DIV_C_9600         22
 #define UART_DIV_C_19200        11
 #define UART_DIV_C_38400        17
@@ -107,6 +128,24 @@ unsigned char Uart_Read(void);
 //setup buffers to write to UART
 unsigned char Uart_Write(char *string);
 
+//write a binary buffer to UART
+unsigned char Uart_WriteBuffer(uint8_t const * _array, uint16_t _length);
+
+//message block to fill in place, waits up to _waitMs for one, NULL when none came free
+void* Uart_AllocMessage(uint32_t _waitMs);
+
+//send a message block without copying, the UART frees it once sent
+unsigned char Uart_SendMessage(void *_block, uint16_t _length);
+
+//give back a message block that is not going to be sent
+void Uart_FreeMessage(void *_block);
+
+//message block pool, for its counters
+BLOCK_POOL const* Uart_GetMessagePool(void);
+
+//receive continuously and feed the bytes to a command parser
+unsigned char Uart_ReceiveStream(CMD_PARSER *_parser);
+
 //initialise SPI
 unsigned char Spi_Init(void);
 
@@ -119,4 +158,19 @@ unsigned char Spi_ReadWrite(uint8_t const * _arrayW, uint16_t _lengthW, uint8_t*
 //write to SPI
 unsigned char Spi_Write(uint8_t const * _array, uint8_t _length);
 
+//set the SPI clock rate
+unsigned char Spi_SetBitrate(uint32_t _bitrate);
+
+//configure hardware flow control for SPI reads
+unsigned char Spi_SetFlowControl(ADI_SPI_FLOW_MODE _mode, uint8_t _burstSize, uint16_t _waitTime, bool_t _rdyActiveLow);
+
+//Write and read using SPI with RDY-gated bursts at the fastest SPI clock
+unsigned char Spi_ReadWriteFlow(uint8_t const * _arrayW, uint16_t _lengthW, uint8_t* _arrayR, uint16_t _lengthR);
+
+//SPI handle opened by Spi_Init, for the drivers that read through Spi_ReadRegister
+ADI_SPI_HANDLE Spi_GetHandle(void);
+
+//send a command and clock in the response in one hardware read-command transaction
+unsigned char Spi_ReadRegister(uint8_t const * _command, uint8_t _commandLength, uint8_t* _arrayR, uint16_t _lengthR);
+
 #endif /* _COMMUNICATION_H_ */
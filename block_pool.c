@@ -0,0 +1,171 @@
+
+#include <stddef.h>
+#include <assert.h>
+#include <adi_processor.h>
+
+#include "block_pool.h"
+
+static BLOCK_POOL *pPools = NULL;//report list, newest first
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_Init
+* Description  : This function links _count blocks of _blockSize bytes at _storage into the
+*                free list of _pool and adds the pool to the report list. Initialising a pool
+*                again frees all its blocks and clears its counters. Not while it is in use.
+* Arguments    : BLOCK_POOL* _pool = pool to initialise
+*                char const* _name = name in reports
+*                void* _storage = word aligned, at least BLOCK_POOL_STORAGE_SIZE bytes
+*                uint32_t _blockSize = bytes per block, rounded up to a multiple of 4
+*                uint32_t _count = number of blocks
+* Return Value : 0 = Success
+*                1 = Failure (no storage, no blocks or storage not word aligned)
+**********************************************************************************************/
+unsigned char BlockPool_Init(BLOCK_POOL *_pool, char const *_name, void *_storage, uint32_t _blockSize, uint32_t _count)
+{
+  BLOCK_POOL const *p;
+  uint8_t *pBlock;
+  uint32_t i;
+
+  if((_storage == NULL) || (_count == 0u) || (((uint32_t)_storage & 3u) != 0u))
+    return 1;
+
+  _pool->pName = _name;
+  _pool->pStorage = (uint8_t *)_storage;
+  _pool->nBlockSize = BLOCK_POOL_BLOCK_SIZE(_blockSize);
+  _pool->nCount = _count;
+
+  //each free block holds the address of the next one
+  pBlock = _pool->pStorage;
+  for(i = 0u; i < (_count - 1u); i++)
+  {
+    *(void **)pBlock = pBlock + _pool->nBlockSize;
+    pBlock += _pool->nBlockSize;
+  }
+  *(void **)pBlock = NULL;
+
+  _pool->pFree = _pool->pStorage;
+  _pool->nFree = _count;
+  _pool->nMinFree = _count;
+  _pool->nExhausted = 0u;
+
+  for(p = pPools; (p != NULL) && (p != _pool); p = p->pNext)
+  {
+  }
+  if(p == NULL)
+  {
+    _pool->pNext = pPools;
+    pPools = _pool;
+  }
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_Alloc
+* Description  : This function takes the first free block of the pool. The caller owns it until
+*                it is freed, by the caller or whoever it was handed to.
+* Arguments    : BLOCK_POOL* _pool = pool initialised by BlockPool_Init
+* Return Value : block of nBlockSize bytes, NULL when the pool is exhausted
+**********************************************************************************************/
+void *BlockPool_Alloc(BLOCK_POOL *_pool)
+{
+  uint32_t primask = __get_PRIMASK();
+  void *pBlock;
+
+  __disable_irq();
+  pBlock = _pool->pFree;
+  if(pBlock == NULL)
+  {
+    _pool->nExhausted++;
+  }
+  else
+  {
+    _pool->pFree = *(void **)pBlock;
+    _pool->nFree--;
+    if(_pool->nFree < _pool->nMinFree)
+      _pool->nMinFree = _pool->nFree;
+  }
+  __set_PRIMASK(primask);
+
+  return pBlock;
+}
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_Free
+* Description  : This function gives a block back to the pool it was taken from
+* Arguments    : BLOCK_POOL* _pool = pool the block was taken from
+*                void* _block = block returned by BlockPool_Alloc, NULL is ignored
+* Return Value : void
+**********************************************************************************************/
+void BlockPool_Free(BLOCK_POOL *_pool, void *_block)
+{
+  uint32_t primask;
+
+  if(_block == NULL)
+    return;
+
+  assert(BlockPool_Owns(_pool, _block));
+  assert((((uint8_t *)_block - _pool->pStorage) % _pool->nBlockSize) == 0u);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  assert(_pool->nFree < _pool->nCount);
+  *(void **)_block = _pool->pFree;
+  _pool->pFree = _block;
+  _pool->nFree++;
+  __set_PRIMASK(primask);
+}
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_Owns
+* Description  : This function tells whether a buffer is a block of the pool, for consumers
+*                that take buffers from more than one source
+* Arguments    : BLOCK_POOL const* _pool = pool
+*                void const* _block = buffer
+* Return Value : true if _block lies in the pool storage
+**********************************************************************************************/
+bool_t BlockPool_Owns(BLOCK_POOL const *_pool, void const *_block)
+{
+  uint8_t const *p = (uint8_t const *)_block;
+
+  return (bool_t)((p >= _pool->pStorage) && (p < &_pool->pStorage[_pool->nCount * _pool->nBlockSize]));
+}
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_InUse
+* Description  : This function returns the number of blocks allocated and not freed yet
+* Arguments    : BLOCK_POOL const* _pool = pool
+* Return Value : blocks in use
+**********************************************************************************************/
+uint32_t BlockPool_InUse(BLOCK_POOL const *_pool)
+{
+  return _pool->nCount - _pool->nFree;
+}
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_Peak
+* Description  : This function returns the most blocks in use at once since BlockPool_Init
+* Arguments    : BLOCK_POOL const* _pool = pool
+* Return Value : peak blocks in use
+**********************************************************************************************/
+uint32_t BlockPool_Peak(BLOCK_POOL const *_pool)
+{
+  return _pool->nCount - _pool->nMinFree;
+}
+
+
+/**********************************************************************************************
+* Function Name: BlockPool_First
+* Description  : This function returns the last initialised pool, the others follow via pNext
+* Arguments    : void
+* Return Value : pool, NULL if none was initialised
+**********************************************************************************************/
+BLOCK_POOL const *BlockPool_First(void)
+{
+  return pPools;
+}
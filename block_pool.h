@@ -0,0 +1,75 @@
+
+#ifndef _BLOCK_POOL_H_
+#define _BLOCK_POOL_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include <stddef.h>
+#include "adi_types.h"
+
+/*
+ * Fixed-size block pool. Blocks are handed out and given back in O(1) from a
+ * free list threaded through the first word of the free blocks, under a short
+ * critical region so interrupt handlers and the main loop can both allocate
+ * and free. A producer fills a block in place and passes the pointer on, the
+ * block then belongs to whoever frees it, so data moves along the pipeline
+ * without copies.
+ *
+ * Every pool counts its peak use and the allocations it refused. Pools are
+ * listed from BlockPool_First for reports (see stack_monitor.h).
+ */
+
+/******************************************************************************/
+/* Types                                                                      */
+/******************************************************************************/
+
+typedef struct BLOCK_POOL_s
+{
+  struct BLOCK_POOL_s *pNext;         //next pool in the report list
+  char const         *pName;          //name in reports
+  uint8_t            *pStorage;       //count * block size bytes, word aligned
+  uint32_t            nBlockSize;     //bytes per block, multiple of 4
+  uint32_t            nCount;         //blocks in the pool
+  void               *pFree;          //first free block, NULL when exhausted
+  uint32_t            nFree;          //free blocks
+  uint32_t            nMinFree;       //fewest free blocks since BlockPool_Init
+  uint32_t            nExhausted;     //allocations refused since BlockPool_Init
+} BLOCK_POOL;
+
+//block size the pool uses for _size bytes
+#define BLOCK_POOL_BLOCK_SIZE(_size)  (((_size) < 4u) ? 4u : ((((_size) + 3u) / 4u) * 4u))
+
+//word aligned storage for _count blocks of _size bytes
+#define BLOCK_POOL_STORAGE(_name, _size, _count) \
+  uint32_t _name[(BLOCK_POOL_BLOCK_SIZE(_size) / 4u) * (_count)]
+
+//storage bytes for _count blocks of _size bytes
+#define BLOCK_POOL_STORAGE_SIZE(_size, _count)  (BLOCK_POOL_BLOCK_SIZE(_size) * (_count))
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//carve word aligned _storage into _count free blocks of _blockSize bytes
+unsigned char BlockPool_Init(BLOCK_POOL *_pool, char const *_name, void *_storage, uint32_t _blockSize, uint32_t _count);
+
+//take a block, NULL when the pool is exhausted, any context
+void *BlockPool_Alloc(BLOCK_POOL *_pool);
+
+//give back a block taken from this pool, any context
+void BlockPool_Free(BLOCK_POOL *_pool, void *_block);
+
+//true if _block lies in the pool storage
+bool_t BlockPool_Owns(BLOCK_POOL const *_pool, void const *_block);
+
+//blocks in use now and at most so far
+uint32_t BlockPool_InUse(BLOCK_POOL const *_pool);
+uint32_t BlockPool_Peak(BLOCK_POOL const *_pool);
+
+//first pool of the report list, then follow pNext
+BLOCK_POOL const *BlockPool_First(void);
+
+#endif /* _BLOCK_POOL_H_ */
@@ -0,0 +1,357 @@
+
+#include <stddef.h>
+#include <assert.h>
+#include <adi_processor.h>
+#include <services/pwr/adi_pwr.h>
+#include <services/trace/adi_trace.h>
+
+#include "clock_governor.h"
+#include "idle_manager.h"
+
+typedef struct
+{
+  ADI_CALLBACK pfListener;
+  void        *pParam;
+} CLOCK_GOV_LISTENER;
+
+static const uint8_t Dividers[CLOCK_GOV_LEVELS] = { CLOCK_GOV_DIV_LOW, CLOCK_GOV_DIV_MID, CLOCK_GOV_DIV_HIGH };
+
+static CLOCK_GOV_LISTENER Listeners[CLOCK_GOV_LISTENERS];
+static uint32_t nListeners = 0u;
+static uint8_t  Holds[CLOCK_GOV_LEVELS];//outstanding ClockGov_Hold per level
+static uint8_t  Level = CLOCK_GOV_LEVEL_HIGH;//level the clocks run at
+static uint64_t Cycles[CLOCK_GOV_LEVELS];//HCLK cycles spent per level
+static uint32_t Stamp;//DWT cycle count of the last accounting
+static uint32_t Base;//root clock cycles at Stamp, the ClockGov_Cycles timebase
+static volatile bool_t bAsleep = false;//Idle_Wait sleeps, the DWT count stands still
+static uint32_t SleepAt;//RTC1 count when the sleep began
+static uint32_t Changes;
+
+
+/********************************************************************
+* Charge the cycles since the last call to the current level and     *
+* move the timebase on. Masked, interrupts read Base and Stamp.      *
+*********************************************************************/
+static void Account(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t now, cycles;
+
+  __disable_irq();
+  now = DWT->CYCCNT;
+  cycles = now - Stamp;
+  Cycles[Level] += cycles;
+  Base += cycles * Dividers[Level];
+  Stamp = now;
+  __set_PRIMASK(primask);
+}
+
+//start charging the new level, masked like Account
+static void Switch(uint8_t _level)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  Account();
+  Level = _level;
+  __set_PRIMASK(primask);
+}
+
+//root clock cycles slept so far, from the RTC1 count
+static uint32_t Slept(void)
+{
+  return (uint32_t)(((uint64_t)(Idle_Ticks() - SleepAt) * CLOCK_GOV_ROOT_HZ) / IDLE_RTC_HZ);
+}
+
+static void Notify(uint32_t _event, uint8_t _level)
+{
+  uint32_t i;
+
+  for(i = 0; i < nListeners; i++)
+    Listeners[i].pfListener(Listeners[i].pParam, _event, (void *)(uint32_t)_level);
+}
+
+
+/********************************************************************
+* Switch the clocks to _level                                        *
+*********************************************************************/
+static unsigned char SetLevel(uint8_t _level)
+{
+  uint8_t div = Dividers[_level];
+  unsigned char failed = 0;
+
+  if(_level == Level)
+    return 0;
+
+  Notify(CLOCK_GOV_EVENT_PRE_CHANGE, _level);
+  Account();
+
+  //PCLK may not run faster than HCLK and must divide it, so the
+  //faster clock moves first in either direction
+  if(_level > Level)
+  {
+#if (CLOCK_GOV_HPBUCK == 1)
+    if(_level == CLOCK_GOV_LEVEL_HIGH)
+      adi_pwr_EnableHPBuck(true);
+#endif
+    if((adi_pwr_SetClockDivider(ADI_CLOCK_HCLK, div) != ADI_PWR_SUCCESS) ||
+       (adi_pwr_SetClockDivider(ADI_CLOCK_PCLK, div) != ADI_PWR_SUCCESS))
+      failed = 1;
+  }
+  else
+  {
+    if((adi_pwr_SetClockDivider(ADI_CLOCK_PCLK, div) != ADI_PWR_SUCCESS) ||
+       (adi_pwr_SetClockDivider(ADI_CLOCK_HCLK, div) != ADI_PWR_SUCCESS))
+      failed = 1;
+#if (CLOCK_GOV_HPBUCK == 1)
+    if((failed == 0) && (Level == CLOCK_GOV_LEVEL_HIGH))
+      adi_pwr_EnableHPBuck(false);
+#endif
+  }
+  adi_pwr_UpdateCoreClock();
+
+  //even after a refused divider the listeners follow the clocks as they are
+  if(failed == 0)
+  {
+    Switch(_level);
+    Changes++;
+  }
+  ADI_TRACE(ADI_TRACE_CLOCK_DIV, Dividers[Level]);
+  Notify(CLOCK_GOV_EVENT_POST_CHANGE, Level);
+  return failed;
+}
+
+//highest level held, CLOCK_GOV_LEVEL_LOW if none
+static uint8_t Wanted(void)
+{
+  uint8_t level = CLOCK_GOV_LEVELS - 1u;
+
+  while((level > CLOCK_GOV_LEVEL_LOW) && (Holds[level] == 0u))
+    level--;
+  return level;
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Init
+* Description  : This function sets HCLK, PCLK and the HP buck to _level and clears the holds
+*                and the statistics. Call it once after adi_pwr_Init, before the peripherals
+*                are opened, listeners are not notified.
+* Arguments    : uint8_t _level = starting level, CLOCK_GOV_LEVEL_xxx
+* Return Value : 0 = Success
+*                1 = Failure (invalid level or the dividers were refused)
+**********************************************************************************************/
+unsigned char ClockGov_Init(uint8_t _level)
+{
+  uint32_t i;
+
+  if(_level >= CLOCK_GOV_LEVELS)
+    return 1;
+
+  //both at 1 first, any divider pair is valid from there
+  if((adi_pwr_SetClockDivider(ADI_CLOCK_HCLK, 1u) != ADI_PWR_SUCCESS) ||
+     (adi_pwr_SetClockDivider(ADI_CLOCK_PCLK, 1u) != ADI_PWR_SUCCESS))
+    return 1;
+  if((adi_pwr_SetClockDivider(ADI_CLOCK_PCLK, Dividers[_level]) != ADI_PWR_SUCCESS) ||
+     (adi_pwr_SetClockDivider(ADI_CLOCK_HCLK, Dividers[_level]) != ADI_PWR_SUCCESS))
+    return 1;
+#if (CLOCK_GOV_HPBUCK == 1)
+  adi_pwr_EnableHPBuck((bool_t)(_level == CLOCK_GOV_LEVEL_HIGH));
+#endif
+  adi_pwr_UpdateCoreClock();
+
+  for(i = 0; i < CLOCK_GOV_LEVELS; i++)
+  {
+    Holds[i] = 0u;
+    Cycles[i] = 0u;
+  }
+  Level = _level;
+  Changes = 0u;
+
+  //cycle counter for the residency and the timebase
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  Stamp = DWT->CYCCNT;
+  Base = 0u;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Register
+* Description  : This function adds a listener called around every level change, see
+*                clock_governor.h for the events. Listeners run in the main loop, in the
+*                order they were registered.
+* Arguments    : ADI_CALLBACK _listener = listener
+*                void* _param = first listener argument
+* Return Value : 0 = Success
+*                1 = Failure (no listener or CLOCK_GOV_LISTENERS already registered)
+**********************************************************************************************/
+unsigned char ClockGov_Register(ADI_CALLBACK _listener, void *_param)
+{
+  if((_listener == NULL) || (nListeners >= CLOCK_GOV_LISTENERS))
+    return 1;
+
+  Listeners[nListeners].pfListener = _listener;
+  Listeners[nListeners].pParam = _param;
+  nListeners++;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Hold
+* Description  : This function raises the clocks to _level if they run slower and keeps them
+*                there until the hold is released. Holds nest.
+* Arguments    : uint8_t _level = level the following work needs
+* Return Value : 0 = Success
+*                1 = Failure (invalid level or the dividers were refused)
+**********************************************************************************************/
+unsigned char ClockGov_Hold(uint8_t _level)
+{
+  assert(__get_IPSR() == 0u);
+  if(_level >= CLOCK_GOV_LEVELS)
+    return 1;
+
+  Holds[_level]++;
+  return SetLevel(Wanted());
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Release
+* Description  : This function releases a hold of ClockGov_Hold, the clocks drop to the
+*                highest level still held
+* Arguments    : uint8_t _level = level passed to ClockGov_Hold
+* Return Value : 0 = Success
+*                1 = Failure (level not held or the dividers were refused)
+**********************************************************************************************/
+unsigned char ClockGov_Release(uint8_t _level)
+{
+  assert(__get_IPSR() == 0u);
+  if((_level >= CLOCK_GOV_LEVELS) || (Holds[_level] == 0u))
+    return 1;
+
+  Holds[_level]--;
+  return SetLevel(Wanted());
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Level
+* Description  : This function returns the level the clocks run at
+* Arguments    : void
+* Return Value : CLOCK_GOV_LEVEL_xxx
+**********************************************************************************************/
+uint8_t ClockGov_Level(void)
+{
+  return Level;
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Residency
+* Description  : This function returns the time spent at a level since ClockGov_Init
+* Arguments    : uint8_t _level = CLOCK_GOV_LEVEL_xxx
+* Return Value : time in ms, 0 for an invalid level
+**********************************************************************************************/
+uint32_t ClockGov_Residency(uint8_t _level)
+{
+  if(_level >= CLOCK_GOV_LEVELS)
+    return 0;
+
+  Account();
+  return (uint32_t)(Cycles[_level] / ((CLOCK_GOV_ROOT_HZ / 1000u) / Dividers[_level]));
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Cycles
+* Description  : This function returns the time since ClockGov_Init in cycles of the root
+*                clock, whatever the level. Callable from interrupts.
+* Arguments    : void
+* Return Value : root clock cycles, wraps every 2^32 / CLOCK_GOV_ROOT_HZ seconds
+**********************************************************************************************/
+uint32_t ClockGov_Cycles(void)
+{
+  //Account runs masked, an interrupt never sees Base and Stamp half updated
+  if(bAsleep)
+    return Base + Slept();
+  return Base + (DWT->CYCCNT - Stamp) * Dividers[Level];
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_MsUntil
+* Description  : This function returns the time left until ClockGov_Cycles reaches _at,
+*                rounded up so a wait of that length never ends early. Callable from
+*                interrupts.
+* Arguments    : uint32_t _at = deadline in root clock cycles, less than 2^31 cycles away
+* Return Value : time in ms, 0 once the deadline has passed
+**********************************************************************************************/
+uint32_t ClockGov_MsUntil(uint32_t _at)
+{
+  uint32_t left = _at - ClockGov_Cycles();
+
+  if((int32_t)left <= 0)
+    return 0;
+  return (left + ((CLOCK_GOV_ROOT_HZ / 1000u) - 1u)) / (CLOCK_GOV_ROOT_HZ / 1000u);
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_SleepBegin
+* Description  : This function hands the timebase over to RTC1 before a sleep that stops the
+*                DWT cycle counter. Interrupts served during the sleep read ClockGov_Cycles
+*                from the RTC count, at its resolution. Called by Idle_Wait only.
+* Arguments    : void
+* Return Value : void
+**********************************************************************************************/
+void ClockGov_SleepBegin(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  Account();
+  SleepAt = Idle_Ticks();
+  bAsleep = true;
+  __set_PRIMASK(primask);
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_SleepEnd
+* Description  : This function adds the time slept to the timebase and to the residency of the
+*                current level, the clocks kept their dividers, and restarts the accounting
+*                from the DWT cycle counter. Called by Idle_Wait only.
+* Arguments    : void
+* Return Value : void
+**********************************************************************************************/
+void ClockGov_SleepEnd(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slept;
+
+  __disable_irq();
+  slept = Slept();
+  Base += slept;
+  Cycles[Level] += slept / Dividers[Level];
+
+  //hibernate may power the debug block down
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  Stamp = DWT->CYCCNT;
+  bAsleep = false;
+  __set_PRIMASK(primask);
+}
+
+
+/**********************************************************************************************
+* Function Name: ClockGov_Changes
+* Description  : This function returns the number of level changes since ClockGov_Init
+* Arguments    : void
+* Return Value : level changes
+**********************************************************************************************/
+uint32_t ClockGov_Changes(void)
+{
+  return Changes;
+}
@@ -0,0 +1,97 @@
+
+#ifndef _CLOCK_GOVERNOR_H_
+#define _CLOCK_GOVERNOR_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include <services/int/adi_int.h>
+
+
+/******************************************************************************/
+/* clock governor parameters                                                  */
+/******************************************************************************/
+
+/*
+ * Workload driven clock scaling. HCLK and PCLK both divide the 26MHz root
+ * clock by the divider of the current level, the HP buck supplies the core at
+ * the top level. Work that needs speed holds a level with ClockGov_Hold and
+ * releases it with ClockGov_Release, the clocks follow the highest level held
+ * and drop to CLOCK_GOV_LEVEL_LOW when nothing is held, e.g. while the main
+ * loop waits.
+ *
+ * Changing PCLK changes every peripheral clock divided from it. Listeners
+ * registered with ClockGov_Register are called with CLOCK_GOV_EVENT_PRE_CHANGE
+ * before the change, to let transfers in flight finish, and with
+ * CLOCK_GOV_EVENT_POST_CHANGE after it, to set their divisors again from
+ * adi_pwr_GetClockFrequency. pArg is the new level. Timers that must keep
+ * their period run from HFOSC instead of PCLK.
+ *
+ * Levels only change from the main loop. The DWT cycle counter counts HCLK
+ * cycles and advances slower at the lower levels, timeouts and timestamps
+ * use ClockGov_Cycles instead: root clock cycles at any level, from the DWT
+ * count scaled by the divider of the level it was counted at. The event
+ * trace records ADI_TRACE_CLOCK_DIV on each change to scale its raw counts.
+ * The accounting must see a change or a query at least every 2^32 cycles.
+ *
+ * The DWT count also stops while the core sleeps. Idle_Wait brackets each
+ * sleep with ClockGov_SleepBegin and ClockGov_SleepEnd, the timebase runs on
+ * the RTC1 count meanwhile (idle_manager.h) and the time slept counts to the
+ * residency of the level held, so deadlines keep their meaning across sleeps.
+ */
+#define CLOCK_GOV_ROOT_HZ       26000000u    //HFOSC, the clock the levels divide
+
+//levels, in increasing speed
+#define CLOCK_GOV_LEVEL_LOW     0            //6.5MHz, waiting
+#define CLOCK_GOV_LEVEL_MID     1            //13MHz, sampling and protocol work
+#define CLOCK_GOV_LEVEL_HIGH    2            //26MHz, radio boot and bulk transmit
+#define CLOCK_GOV_LEVELS        3
+
+#define CLOCK_GOV_DIV_LOW       4            //HCLK and PCLK dividers, powers of two
+#define CLOCK_GOV_DIV_MID       2
+#define CLOCK_GOV_DIV_HIGH      1
+
+#define CLOCK_GOV_HPBUCK        1            //1 to run CLOCK_GOV_LEVEL_HIGH on the HP buck, needs its external parts
+#define CLOCK_GOV_LISTENERS     4            //listeners ClockGov_Register accepts
+
+//listener events
+#define CLOCK_GOV_EVENT_PRE_CHANGE   0       //clocks about to change, finish what PCLK clocks
+#define CLOCK_GOV_EVENT_POST_CHANGE  1       //clocks changed, set the divisors again
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//set the clocks to _level, before the peripherals are opened
+unsigned char ClockGov_Init(uint8_t _level);
+
+//call _listener with _param around every level change
+unsigned char ClockGov_Register(ADI_CALLBACK _listener, void *_param);
+
+//raise the clocks to at least _level until the matching ClockGov_Release, main loop only
+unsigned char ClockGov_Hold(uint8_t _level);
+unsigned char ClockGov_Release(uint8_t _level);
+
+//current level
+uint8_t ClockGov_Level(void);
+
+//time spent at _level since ClockGov_Init, in ms
+uint32_t ClockGov_Residency(uint8_t _level);
+
+//root clock cycles since ClockGov_Init, any context
+uint32_t ClockGov_Cycles(void);
+
+//ms left until ClockGov_Cycles reaches _at, 0 once passed, any context
+uint32_t ClockGov_MsUntil(uint32_t _at);
+
+//timebase across a sleep that stops the DWT count, Idle_Wait only
+void ClockGov_SleepBegin(void);
+void ClockGov_SleepEnd(void);
+
+//level changes since ClockGov_Init
+uint32_t ClockGov_Changes(void);
+
+#endif /* _CLOCK_GOVERNOR_H_ */
@@ -0,0 +1,164 @@
+
+#include <adi_processor.h>
+#include <system.h>
+#include <services/int/adi_int.h>
+#include <services/pwr/adi_pwr.h>
+
+#include "common.h"
+#include "BLE_Module.h"
+#include "sensor_sampler.h"
+#include "isr_benchmark.h"
+#include "code_bench.h"
+
+extern int16_t BatchTemperature(SAMPLER_SAMPLE const *pBatch);//sample formatter, temperature_sensor.c
+
+//candidate handlers, defined by the drivers
+ADI_INT_HANDLER(UART_Int_Handler);
+ADI_INT_HANDLER(DMA_SPI0_TX_Int_Handler);
+ADI_INT_HANDLER(DMA_SPI0_RX_Int_Handler);
+ADI_INT_HANDLER(DMA_UART_TX_Int_Handler);
+ADI_INT_HANDLER(DMA_UART_RX_Int_Handler);
+ADI_INT_HANDLER(DMA_I2C0_MX_Int_Handler);
+
+typedef uint32_t (*CODE_BENCH_FN)(void);
+
+typedef struct
+{
+  const char    *Name;
+  void const    *Code;              //entry point, tells where the candidate was linked
+  CODE_BENCH_FN  Run;               //one timed call, NULL for the handlers
+} CODE_BENCH_CANDIDATE;
+
+static uint32_t RunCrc(void);
+static uint32_t RunFormat(void);
+
+static const CODE_BENCH_CANDIDATE Candidates[] =
+{
+  { "UART_Int_Handler",         (void const *)UART_Int_Handler,         NULL },
+  { "DMA_SPI0_TX_Int_Handler",  (void const *)DMA_SPI0_TX_Int_Handler,  NULL },
+  { "DMA_SPI0_RX_Int_Handler",  (void const *)DMA_SPI0_RX_Int_Handler,  NULL },
+  { "DMA_UART_TX_Int_Handler",  (void const *)DMA_UART_TX_Int_Handler,  NULL },
+  { "DMA_UART_RX_Int_Handler",  (void const *)DMA_UART_RX_Int_Handler,  NULL },
+  { "DMA_I2C0_MX_Int_Handler",  (void const *)DMA_I2C0_MX_Int_Handler,  NULL },
+  { "calc_crc",                 (void const *)calc_crc,                 RunCrc },
+  { "BatchTemperature",         (void const *)BatchTemperature,         RunFormat }
+};
+
+static uint32_t CrcData[CODE_BENCH_CRC_WORDS];//in SRAM, only the code fetches differ
+static SAMPLER_SAMPLE Batch[SAMPLER_BATCH_SIZE];
+static volatile uint32_t Sink;//keeps the results alive
+
+
+/********************************************************************
+* Time one call of each direct candidate                             *
+*********************************************************************/
+static uint32_t RunCrc(void)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  Sink = calc_crc((uint8_t const *)CrcData, CODE_BENCH_CRC_WORDS);
+  return DWT->CYCCNT - start;
+}
+
+static uint32_t RunFormat(void)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  Sink = (uint32_t)BatchTemperature(Batch);
+  return DWT->CYCCNT - start;
+}
+
+
+/********************************************************************
+* Run the direct candidates under the current cache setting          *
+*********************************************************************/
+static void RunDirect(const char *_cache)
+{
+  uint32_t primask;
+  uint32_t c, i;
+  uint32_t cycles, min, max, sum;
+
+  for(c = 0; c < (sizeof(Candidates) / sizeof(Candidates[0])); c++)
+  {
+    if(Candidates[c].Run == NULL)
+      continue;
+
+    min = 0xFFFFFFFFu;
+    max = 0u;
+    sum = 0u;
+    for(i = 0; i < CODE_BENCH_RUNS; i++)
+    {
+      //no interrupt in between, the first call sees a cold cache
+      primask = __get_PRIMASK();
+      __disable_irq();
+      cycles = Candidates[c].Run();
+      __set_PRIMASK(primask);
+
+      if(cycles < min)
+        min = cycles;
+      if(cycles > max)
+        max = cycles;
+      sum += cycles;
+    }
+    DEBUG_MESSAGE("codebench,%s,%s,%u,%u,%u,%u\n", Candidates[c].Name, _cache,
+                  CODE_BENCH_RUNS, min, sum / CODE_BENCH_RUNS, max);
+  }
+}
+
+
+/**********************************************************************************************
+* Function Name: CodeBench_Run
+* Description  : This function prints where each hot code candidate was linked and times them
+*                with the flash cache off and on, see code_bench.h for the format. The handlers
+*                are timed through IsrBenchmark_Run, which borrows UART0 and SPI1.
+* Arguments    : ADI_I2C_HANDLE _hI2c = open I2C master with the sensor on the bus
+*                uint16_t _address = sensor address
+*                uint8_t _register = sensor register to read
+* Return Value : 0 = Success
+*                1 = Failure, the clock could not be read or the ISR benchmark failed
+**********************************************************************************************/
+unsigned char CodeBench_Run(ADI_I2C_HANDLE _hI2c, uint16_t _address, uint8_t _register)
+{
+  static const char * const CacheName[2] = { "nocache", "cache" };
+  bool_t cached = (pADI_FLCC0_CACHE->SETUP & BITM_FLCC_CACHE_SETUP_ICEN) != 0u;
+  uint32_t hclk;
+  uint32_t c, i;
+  unsigned char failed = 0;
+
+  if(adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &hclk) != ADI_PWR_SUCCESS)
+    return 1;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for(i = 0; i < CODE_BENCH_CRC_WORDS; i++)
+    CrcData[i] = i * 0x01010101u;
+  for(i = 0; i < SAMPLER_BATCH_SIZE; i++)
+  {
+    Batch[i].Data[0] = (uint8_t)(0x0Cu + i);//around 25 deg C
+    Batch[i].Data[1] = (uint8_t)(i << 3u);
+    Batch[i].Status = (uint8_t)((i == 3u) ? 1u : 0u);
+  }
+
+  DEBUG_MESSAGE("codebench,hclk,%u\n", hclk);
+  for(c = 0; c < (sizeof(Candidates) / sizeof(Candidates[0])); c++)
+  {
+    DEBUG_MESSAGE("codebench,placement,%s,%s\n", Candidates[c].Name,
+                  ADI_IN_ISRAM(Candidates[c].Code) ? "isram" : "flash");
+  }
+
+  DEBUG_MESSAGE("codebench,candidate,cache,calls,min,avg,max\n");
+  for(i = 0; i < 2u; i++)
+  {
+    adi_system_EnableCache((bool_t)(i != 0u));
+    DEBUG_MESSAGE("codebench,cache,%s\n", CacheName[i]);
+    RunDirect(CacheName[i]);
+#if (ADI_CFG_ENABLE_STATS == 1)
+    if(IsrBenchmark_Run(_hI2c, _address, _register) != 0)
+      failed = 1;
+#endif
+  }
+
+  adi_system_EnableCache(cached);
+  return failed;
+}
@@ -0,0 +1,48 @@
+
+#ifndef _CODE_BENCH_H_
+#define _CODE_BENCH_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include <drivers/i2c/adi_i2c.h>
+
+
+/******************************************************************************/
+/* code placement benchmark parameters                                        */
+/******************************************************************************/
+
+/*
+ * Startup benchmark of the hot code placement. The candidates marked
+ * ADI_ISRAM_CODE (UART and DMA handlers, calc_crc, BatchTemperature) run from
+ * instruction SRAM when ADI_CFG_ISRAM_HOT_CODE is set in adi_global_config.h
+ * and from flash otherwise, each one is listed with where it was linked:
+ *
+ *   codebench,placement,<candidate>,<isram|flash>
+ *
+ * Then every candidate runs with the flash cache off and on. calc_crc and
+ * BatchTemperature are called CODE_BENCH_RUNS times and timed in core cycles
+ * at the HCLK of the "codebench,hclk,<Hz>" line:
+ *
+ *   codebench,<candidate>,<nocache|cache>,<calls>,<min>,<avg>,<max>
+ *
+ * The handlers are timed by the ISR benchmark (isr_benchmark.h) when
+ * ADI_CFG_ENABLE_STATS is set, its lines follow a "codebench,cache,<nocache|cache>"
+ * line. A capture of a flash build gives the flash uncached and cached cycles,
+ * one of an ISRAM build the ISRAM cycles, tools/isr_bench_diff.py compares
+ * them. The cache setting found at startup is restored.
+ */
+#define CODE_BENCH_RUNS         20                 //calls of each direct candidate per cache setting
+#define CODE_BENCH_CRC_WORDS    256                //words checked per calc_crc call
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//time the candidates with the cache off and on, same arguments as IsrBenchmark_Run
+unsigned char CodeBench_Run(ADI_I2C_HANDLE _hI2c, uint16_t _address, uint8_t _register);
+
+#endif /* _CODE_BENCH_H_ */
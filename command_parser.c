@@ -0,0 +1,173 @@
+
+#include <stddef.h>
+#include <string.h>
+#include <adi_processor.h>
+
+#include "command_parser.h"
+
+/*
+ * Incremental parser for length prefixed command frames. Bytes can be fed in
+ * any split, from interrupt or thread context, and each complete frame is
+ * dispatched straight away through the command table: the command ID is the
+ * table index so dispatch takes the same time for every command.
+ */
+
+//frame field expected next
+#define STATE_SYNC      0u
+#define STATE_ID        1u
+#define STATE_LENGTH    2u
+#define STATE_PAYLOAD   3u
+
+
+/********************************************************************
+* Drop the frame in progress and hunt for the next SYNC              *
+*********************************************************************/
+static void DropFrame(CMD_PARSER *_parser)
+{
+  _parser->Stats.Errors++;
+  _parser->State = STATE_SYNC;
+}
+
+
+/********************************************************************
+* Call the handler of the complete frame and time it                 *
+*********************************************************************/
+static void Dispatch(CMD_PARSER *_parser, uint32_t _parseCycles)
+{
+  CMD_PARSER_STATS *pStats = &_parser->Stats;
+  uint32_t start;
+  uint32_t cycles;
+
+  pStats->LastParseCycles = _parseCycles;
+  if(_parseCycles > pStats->MaxParseCycles)
+    pStats->MaxParseCycles = _parseCycles;
+
+  start = DWT->CYCCNT;
+  _parser->pTable[_parser->Id].pfHandler(_parser->Payload, _parser->Length);
+  cycles = DWT->CYCCNT - start;
+
+  pStats->LastDispatchCycles = cycles;
+  if(cycles > pStats->MaxDispatchCycles)
+    pStats->MaxDispatchCycles = cycles;
+
+  pStats->Frames++;
+  _parser->State = STATE_SYNC;
+}
+
+
+/**********************************************************************************************
+* Function Name: CmdParser_Init
+* Description  : This function attaches a dispatch table of CMD_TABLE_SIZE entries to a parser,
+*                clears its statistics and starts the core cycle counter used for the timings
+* Arguments    : CMD_PARSER* _parser = parser to initialise
+*                CMD_ENTRY const* _table = dispatch table indexed by command ID
+* Return Value : void
+**********************************************************************************************/
+void CmdParser_Init(CMD_PARSER *_parser, CMD_ENTRY const *_table)
+{
+  memset(_parser, 0, sizeof(*_parser));
+  _parser->pTable = _table;
+  _parser->State = STATE_SYNC;
+
+  //cycle counter for the latencies
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+/**********************************************************************************************
+* Function Name: CmdParser_Feed
+* Description  : This function runs _length received bytes through the frame state machine.
+*                Every frame completed by these bytes is dispatched before the function
+*                returns, from the context of the caller.
+* Arguments    : CMD_PARSER* _parser = parser initialised by CmdParser_Init
+*                uint8_t const* _data = received bytes
+*                uint32_t _length = number of bytes
+* Return Value : void
+**********************************************************************************************/
+void CmdParser_Feed(CMD_PARSER *_parser, uint8_t const * _data, uint32_t _length)
+{
+  CMD_ENTRY const *pEntry;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t chunk;
+  uint8_t  byte;
+
+  while(_length > 0u)
+  {
+    switch(_parser->State)
+    {
+      case STATE_SYNC:
+        byte = *_data++;
+        _length--;
+        if(byte == CMD_FRAME_SYNC)
+        {
+          _parser->ParseCycles = 0u;
+          _parser->State = STATE_ID;
+          start = DWT->CYCCNT;
+        }
+        else
+          _parser->Stats.Errors++;
+        break;
+
+      case STATE_ID:
+        _parser->Id = *_data++;
+        _length--;
+        if((_parser->Id >= CMD_TABLE_SIZE) || (_parser->pTable[_parser->Id].pfHandler == NULL))
+          DropFrame(_parser);
+        else
+          _parser->State = STATE_LENGTH;
+        break;
+
+      case STATE_LENGTH:
+        _parser->Length = *_data++;
+        _length--;
+        pEntry = &_parser->pTable[_parser->Id];
+        //MaxLength above CMD_MAX_PAYLOAD would overrun Payload, the buffer limit wins
+        if((_parser->Length < pEntry->MinLength) || (_parser->Length > pEntry->MaxLength) ||
+           (_parser->Length > CMD_MAX_PAYLOAD))
+          DropFrame(_parser);
+        else if(_parser->Length == 0u)
+          Dispatch(_parser, _parser->ParseCycles + (DWT->CYCCNT - start));
+        else
+        {
+          _parser->Count = 0u;
+          _parser->State = STATE_PAYLOAD;
+        }
+        break;
+
+      case STATE_PAYLOAD:
+        //take as much of the payload as this call holds in one go
+        chunk = (uint32_t)(_parser->Length - _parser->Count);
+        if(chunk > _length)
+          chunk = _length;
+        memcpy(&_parser->Payload[_parser->Count], _data, chunk);
+        _parser->Count += (uint8_t)chunk;
+        _data += chunk;
+        _length -= chunk;
+        if(_parser->Count == _parser->Length)
+          Dispatch(_parser, _parser->ParseCycles + (DWT->CYCCNT - start));
+        break;
+
+      default:
+        _parser->State = STATE_SYNC;
+        break;
+    }
+  }
+
+  //frame continues in the next call
+  if(_parser->State != STATE_SYNC)
+    _parser->ParseCycles += DWT->CYCCNT - start;
+}
+
+
+/**********************************************************************************************
+* Function Name: CmdParser_GetStats
+* Description  : This function returns the frame counters and the last/worst parse and
+*                dispatch times in core clock cycles
+* Arguments    : CMD_PARSER const* _parser = parser
+* Return Value : statistics of the parser
+**********************************************************************************************/
+CMD_PARSER_STATS const* CmdParser_GetStats(CMD_PARSER const *_parser)
+{
+  return &_parser->Stats;
+}
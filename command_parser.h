@@ -0,0 +1,85 @@
+
+#ifndef _COMMAND_PARSER_H_
+#define _COMMAND_PARSER_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+
+
+/******************************************************************************/
+/* command frame parameters                                                   */
+/******************************************************************************/
+
+/*
+ * Command frame on the byte stream:
+ *
+ *   +------+----+--------+-----------------+
+ *   | SYNC | ID | LENGTH | PAYLOAD[LENGTH] |
+ *   +------+----+--------+-----------------+
+ *
+ * Frames can follow each other without gaps. A byte other than SYNC between
+ * frames, an unknown ID or a length outside the command limits drops the
+ * frame and the parser hunts for the next SYNC.
+ */
+#define CMD_FRAME_SYNC          0x7E     //first byte of every frame
+#define CMD_MAX_PAYLOAD         32       //largest payload the parser buffers
+#define CMD_TABLE_SIZE          16       //command IDs 0..CMD_TABLE_SIZE-1 can be dispatched, 1-5 are the API_COMMANDS of uart_handler.h
+
+
+/******************************************************************************/
+/* Types                                                                      */
+/******************************************************************************/
+
+//command handler, called with the payload of a complete frame
+typedef void (*CMD_HANDLER)(uint8_t const * _payload, uint8_t _length);
+
+//dispatch table entry, the table is indexed by command ID
+typedef struct
+{
+  CMD_HANDLER pfHandler;              //NULL = unknown command
+  uint8_t     MinLength;              //smallest accepted payload
+  uint8_t     MaxLength;              //largest accepted payload, at most CMD_MAX_PAYLOAD
+} CMD_ENTRY;
+
+//parse and dispatch statistics, in core clock cycles
+typedef struct
+{
+  uint32_t Frames;                    //frames dispatched
+  uint32_t Errors;                    //frames or bytes dropped
+  uint32_t LastParseCycles;           //cycles spent parsing the last frame
+  uint32_t MaxParseCycles;            //worst parse time
+  uint32_t LastDispatchCycles;        //cycles spent in the last handler
+  uint32_t MaxDispatchCycles;         //worst handler time
+} CMD_PARSER_STATS;
+
+//parser state, one per byte stream
+typedef struct
+{
+  CMD_ENTRY const *pTable;            //CMD_TABLE_SIZE entries
+  uint8_t          State;             //frame field expected next
+  uint8_t          Id;                //command ID of the frame in progress
+  uint8_t          Length;            //payload length of the frame in progress
+  uint8_t          Count;             //payload bytes received so far
+  uint8_t          Payload[CMD_MAX_PAYLOAD];
+  uint32_t         ParseCycles;       //parse time accumulated for the frame in progress
+  CMD_PARSER_STATS Stats;
+} CMD_PARSER;
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//attach a dispatch table to a parser and reset it
+void CmdParser_Init(CMD_PARSER *_parser, CMD_ENTRY const *_table);
+
+//feed received bytes, complete frames are dispatched before returning
+void CmdParser_Feed(CMD_PARSER *_parser, uint8_t const * _data, uint32_t _length);
+
+//parse and dispatch statistics
+CMD_PARSER_STATS const* CmdParser_GetStats(CMD_PARSER const *_parser);
+
+#endif /* _COMMAND_PARSER_H_ */
@@ -0,0 +1,168 @@
+
+#include <stddef.h>
+#include <adi_processor.h>
+
+#include "deferred_log.h"
+#include "command_parser.h"
+#include "packetizer.h"
+#include "spsc_ring.h"
+#include "clock_governor.h"
+
+#define FRAME_HEADER_SIZE   3u          //SYNC, ID, LENGTH
+#define RECORD_HEADER_SIZE  6u          //log ID, timestamp
+
+//one buffered log call
+typedef struct
+{
+  uint32_t Timestamp;                 //ClockGov_Cycles of the call
+  uint16_t Id;                        //LOG_ID
+  uint16_t Count;                     //arguments used
+  uint32_t Args[DLOG_MAX_ARGS];       //raw arguments
+} DLOG_RECORD;
+
+static DLOG_RECORD       RecordMem[DLOG_RING_SIZE];//record storage
+static SPSC_RING         Records;//log calls -> DLog_Drain
+static volatile uint32_t Dropped;//records lost to a full ring, written under the producer lock
+static uint32_t          DroppedSent;//dropped count already reported by DLog_Drain
+
+
+/********************************************************************
+* Store a 32 bit value MSB first                                     *
+*********************************************************************/
+static uint8_t *PutWord(uint8_t *_p, uint32_t _value)
+{
+  _p[0] = (uint8_t)(_value >> 24);
+  _p[1] = (uint8_t)(_value >> 16);
+  _p[2] = (uint8_t)(_value >> 8);
+  _p[3] = (uint8_t)_value;
+  return &_p[4];
+}
+
+
+/**********************************************************************************************
+* Function Name: DLog_Init
+* Description  : This function empties the record ring. The timestamps come from the clock
+*                governor, ClockGov_Init must have run
+* Arguments    : void
+* Return Value : void
+**********************************************************************************************/
+void DLog_Init(void)
+{
+  SpscRing_Init(&Records, RecordMem, sizeof(RecordMem[0]), DLOG_RING_SIZE);
+  Dropped = 0u;
+  DroppedSent = 0u;
+}
+
+
+/**********************************************************************************************
+* Function Name: DLog_Write
+* Description  : This function stores a log record in the ring, or counts it as dropped when
+*                the ring is full. Callable from interrupts and from the main loop, producers
+*                are serialised by masking interrupts for the few stores of one record (the
+*                PRIMASK is restored, so callers that already run masked stay masked).
+* Arguments    : LOG_ID _id = message of log_messages.h
+*                uint32_t _count = arguments used, at most DLOG_MAX_ARGS
+*                uint32_t _a, _b, _c = raw arguments
+* Return Value : void
+**********************************************************************************************/
+void DLog_Write(LOG_ID _id, uint32_t _count, uint32_t _a, uint32_t _b, uint32_t _c)
+{
+  DLOG_RECORD *pRecord;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  pRecord = (DLOG_RECORD *)SpscRing_WriteSlot(&Records);
+  if(pRecord == NULL)
+    Dropped++;
+  else
+  {
+    pRecord->Timestamp = ClockGov_Cycles();
+    pRecord->Id = (uint16_t)_id;
+    pRecord->Count = (uint16_t)_count;
+    pRecord->Args[0] = _a;
+    pRecord->Args[1] = _b;
+    pRecord->Args[2] = _c;
+    SpscRing_Commit(&Records);
+  }
+
+  __set_PRIMASK(primask);
+}
+
+
+/**********************************************************************************************
+* Function Name: DLog_Drain
+* Description  : This function sends up to _max buffered records as DLOG frames through the
+*                packetizer, preceded by a LOG_DROPPED record when records were lost since the
+*                last drain. A record the packetizer cannot take stays buffered for the next
+*                call. Main loop only.
+* Arguments    : uint32_t _max = largest number of records to send in this call
+* Return Value : 0 = Success
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char DLog_Drain(uint32_t _max)
+{
+  uint8_t frame[FRAME_HEADER_SIZE + RECORD_HEADER_SIZE + (4u * DLOG_MAX_ARGS)];
+  DLOG_RECORD const *pRecord;
+  DLOG_RECORD lost;
+  uint8_t *p;
+  uint32_t dropped = Dropped;
+  uint32_t i;
+
+  while(_max > 0u)
+  {
+    //report losses first, they happened before the records still in the ring
+    if(dropped != DroppedSent)
+    {
+      lost.Timestamp = ClockGov_Cycles();
+      lost.Id = (uint16_t)LOG_DROPPED;
+      lost.Count = 1u;
+      lost.Args[0] = dropped - DroppedSent;
+      DroppedSent = dropped;
+      pRecord = &lost;
+    }
+    else
+    {
+      pRecord = (DLOG_RECORD const *)SpscRing_ReadSlot(&Records);
+      if(pRecord == NULL)
+        break;
+    }
+
+    frame[0] = CMD_FRAME_SYNC;
+    frame[1] = DLOG_FRAME_ID;
+    frame[2] = (uint8_t)(RECORD_HEADER_SIZE + (4u * pRecord->Count));
+    frame[3] = (uint8_t)(pRecord->Id >> 8);
+    frame[4] = (uint8_t)pRecord->Id;
+    p = PutWord(&frame[5], pRecord->Timestamp);
+    for(i = 0u; i < pRecord->Count; i++)
+      p = PutWord(p, pRecord->Args[i]);
+
+    //a record the packetizer refused stays queued for the next drain, the refused
+    //loss report goes back into the count it was taken from
+    if(Packetizer_Write(frame, (uint16_t)(p - frame)) != 0)
+    {
+      if(pRecord == &lost)
+        DroppedSent -= lost.Args[0];
+      return 1;
+    }
+
+    if(pRecord != &lost)
+      SpscRing_Release(&Records);
+
+    _max--;
+  }
+
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: DLog_GetDropped
+* Description  : This function returns the number of records lost because the ring was full
+* Arguments    : void
+* Return Value : records dropped since DLog_Init
+**********************************************************************************************/
+uint32_t DLog_GetDropped(void)
+{
+  return Dropped;
+}
@@ -0,0 +1,65 @@
+
+#ifndef _DEFERRED_LOG_H_
+#define _DEFERRED_LOG_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+
+
+/******************************************************************************/
+/* deferred log parameters                                                    */
+/******************************************************************************/
+
+/*
+ * Deferred logging. A call site stores its log ID, the root clock cycle count
+ * (ClockGov_Cycles, clock_governor.h) and its raw arguments in a RAM ring,
+ * nothing is formatted on the device.
+ * DLog_Drain sends the records from the main loop as command frames
+ * (command_parser.h) through the packetizer:
+ *
+ *   DLOG frame payload = log ID (2 bytes), root cycle count (4 bytes),
+ *                        arguments (4 bytes each), all MSB first
+ *
+ * tools/dlog_decode.py turns the frames back into text with the formats of
+ * log_messages.h.
+ */
+#define DLOG_RING_SIZE          32       //records buffered between drains, MUST BE A POWER OF TWO
+#define DLOG_MAX_ARGS           3        //32 bit arguments per record
+#define DLOG_FRAME_ID           0x12     //device to host frame ID
+
+//log IDs, in the order of log_messages.h
+typedef enum
+{
+#define LOG_MESSAGE(_id, _format) _id,
+#include "log_messages.h"
+#undef LOG_MESSAGE
+  LOG_MESSAGE_COUNT
+} LOG_ID;
+
+//log a message with 0 to DLOG_MAX_ARGS arguments, from any context
+#define DLOG0(_id)              DLog_Write((_id), 0u, 0u, 0u, 0u)
+#define DLOG1(_id, _a)          DLog_Write((_id), 1u, (uint32_t)(_a), 0u, 0u)
+#define DLOG2(_id, _a, _b)      DLog_Write((_id), 2u, (uint32_t)(_a), (uint32_t)(_b), 0u)
+#define DLOG3(_id, _a, _b, _c)  DLog_Write((_id), 3u, (uint32_t)(_a), (uint32_t)(_b), (uint32_t)(_c))
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//empty the ring, after ClockGov_Init
+void DLog_Init(void);
+
+//store one record, use the DLOG macros
+void DLog_Write(LOG_ID _id, uint32_t _count, uint32_t _a, uint32_t _b, uint32_t _c);
+
+//send up to _max buffered records, main loop only
+unsigned char DLog_Drain(uint32_t _max);
+
+//records lost because the ring was full
+uint32_t DLog_GetDropped(void);
+
+#endif /* _DEFERRED_LOG_H_ */
@@ -0,0 +1,151 @@
+
+#include <stddef.h>
+#include <adi_processor.h>
+#include <services/stats/adi_stats.h>
+
+#include "driver_stats.h"
+#include "packetizer.h"
+
+#define FRAME_HEADER_SIZE   3u          //SYNC, ID, LENGTH
+#define REPORT_HEADER_SIZE  2u          //section, index
+#define REPORT_MAX_WORDS    8u          //largest counter block, ADI_STATS_UART
+#define REQUEST_PENDING     0x8000u     //set in Request until DriverStats_Poll takes it
+
+static volatile uint16_t Request;//pending request, REQUEST_PENDING | section << 8 | flags
+#if (ADI_CFG_ENABLE_STATS == 1)
+static ADI_STATS         Snapshot;//counters being reported
+#endif
+
+
+/********************************************************************
+* Send one REPORT or END frame                                       *
+*********************************************************************/
+static unsigned char SendReport(uint8_t _section, uint8_t _index, uint32_t const *_words, uint32_t _count)
+{
+  uint8_t frame[FRAME_HEADER_SIZE + REPORT_HEADER_SIZE + (4u * REPORT_MAX_WORDS)];
+  uint8_t *p = &frame[FRAME_HEADER_SIZE + REPORT_HEADER_SIZE];
+  uint32_t i;
+
+  frame[0] = CMD_FRAME_SYNC;
+  frame[1] = DRIVER_STATS_FRAME_ID;
+  frame[2] = (uint8_t)(REPORT_HEADER_SIZE + (4u * _count));
+  frame[3] = _section;
+  frame[4] = _index;
+  for(i = 0u; i < _count; i++)
+  {
+    *p++ = (uint8_t)(_words[i] >> 24);
+    *p++ = (uint8_t)(_words[i] >> 16);
+    *p++ = (uint8_t)(_words[i] >> 8);
+    *p++ = (uint8_t)_words[i];
+  }
+
+  return Packetizer_Write(frame, (uint16_t)(p - frame));
+}
+
+#if (ADI_CFG_ENABLE_STATS == 1)
+/********************************************************************
+* Send the blocks of one section                                     *
+*********************************************************************/
+static unsigned char SendSection(uint8_t _section)
+{
+  uint32_t i;
+
+  switch(_section)
+  {
+  case DRIVER_STATS_SECTION_UART:
+    return SendReport(_section, 0u, (uint32_t const *)&Snapshot.Uart, sizeof(Snapshot.Uart) / 4u);
+
+  case DRIVER_STATS_SECTION_SPI:
+    for(i = 0u; i < ADI_STATS_NUM_SPI; i++)
+    {
+      if(SendReport(_section, (uint8_t)i, (uint32_t const *)&Snapshot.Spi[i], sizeof(Snapshot.Spi[i]) / 4u) != 0)
+        return 1;
+    }
+    return 0;
+
+  case DRIVER_STATS_SECTION_I2C:
+    return SendReport(_section, 0u, (uint32_t const *)&Snapshot.I2c, sizeof(Snapshot.I2c) / 4u);
+
+  case DRIVER_STATS_SECTION_DMA:
+    for(i = 0u; i < ADI_STATS_NUM_DMA; i++)
+    {
+      if((Snapshot.Dma[i].nDone | Snapshot.Dma[i].nErrors) == 0u)
+        continue;
+      if(SendReport(_section, (uint8_t)i, (uint32_t const *)&Snapshot.Dma[i], sizeof(Snapshot.Dma[i]) / 4u) != 0)
+        return 1;
+    }
+    return 0;
+
+  case DRIVER_STATS_SECTION_ISR:
+    for(i = 0u; i < ADI_STATS_NUM_IRQ; i++)
+    {
+      if(Snapshot.Isr[i].nCalls == 0u)
+        continue;
+      if(SendReport(_section, (uint8_t)i, (uint32_t const *)&Snapshot.Isr[i], sizeof(Snapshot.Isr[i]) / 4u) != 0)
+        return 1;
+    }
+    return 0;
+
+  default:
+    return 0;
+  }
+}
+#endif
+
+
+/**********************************************************************************************
+* Function Name: DriverStats_OnRequest
+* Description  : Command handler for DRIVER_STATS_REQUEST_ID frames, see
+*                DRIVER_STATS_REQUEST_ENTRY. Only records the request, the report is sent by
+*                DriverStats_Poll.
+* Arguments    : uint8_t const* _payload = section, flags
+*                uint8_t _length = 2
+* Return Value : void
+**********************************************************************************************/
+void DriverStats_OnRequest(uint8_t const * _payload, uint8_t _length)
+{
+  Request = (uint16_t)(REQUEST_PENDING | ((uint16_t)_payload[0] << 8) | _payload[1]);
+}
+
+
+/**********************************************************************************************
+* Function Name: DriverStats_Poll
+* Description  : This function sends the report of a pending request: a snapshot of the
+*                requested driver counters, reset first if the request asks for it, followed
+*                by an END frame. Without ADI_CFG_ENABLE_STATS only the END frame is sent.
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char DriverStats_Poll(void)
+{
+  uint16_t request = Request;
+  uint32_t now;
+
+  if((request & REQUEST_PENDING) == 0u)
+    return 0;
+  Request = 0u;
+
+#if (ADI_CFG_ENABLE_STATS == 1)
+  {
+    uint8_t section = (uint8_t)(request >> 8);
+    uint8_t s;
+
+    adi_stats_Snapshot(&Snapshot, (request & DRIVER_STATS_FLAG_RESET) != 0u);
+
+    for(s = DRIVER_STATS_SECTION_UART; s <= DRIVER_STATS_SECTION_ISR; s++)
+    {
+      if((section == DRIVER_STATS_SECTION_ALL) || (section == s))
+      {
+        if(SendSection(s) != 0)
+          return 1;
+      }
+    }
+  }
+#endif
+
+  now = DWT->CYCCNT;
+  if(SendReport(DRIVER_STATS_SECTION_END, 0u, &now, 1u) != 0)
+    return 1;
+  return Packetizer_Flush();
+}
@@ -0,0 +1,65 @@
+
+#ifndef _DRIVER_STATS_H_
+#define _DRIVER_STATS_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include "command_parser.h"
+
+
+/******************************************************************************/
+/* driver statistics parameters                                               */
+/******************************************************************************/
+
+/*
+ * Reports the driver counters of adi_stats.h (ADI_CFG_ENABLE_STATS) over the
+ * command frame format of command_parser.h.
+ *
+ * Host to device:
+ *   REQUEST payload = section (DRIVER_STATS_SECTION_xxx, 0 = all), flags
+ *
+ * Device to host, one frame per block, then an END frame:
+ *   REPORT  payload = section, index, counters (4 bytes each, MSB first) in
+ *                     the order of the ADI_STATS_xxx structure
+ *   END     payload = DRIVER_STATS_SECTION_END, 0, DWT cycle count
+ *
+ * DMA channels and interrupts without activity are not reported. The
+ * request is only recorded by the command handler, DriverStats_Poll sends
+ * the report from the main loop.
+ */
+#define DRIVER_STATS_REQUEST_ID       10       //host to device, index in the command table
+#define DRIVER_STATS_FRAME_ID         0x13     //device to host
+
+#define DRIVER_STATS_FLAG_RESET       0x01     //restart the counters after the snapshot
+
+//report sections
+#define DRIVER_STATS_SECTION_ALL      0
+#define DRIVER_STATS_SECTION_UART     1
+#define DRIVER_STATS_SECTION_SPI      2
+#define DRIVER_STATS_SECTION_I2C      3
+#define DRIVER_STATS_SECTION_DMA      4
+#define DRIVER_STATS_SECTION_ISR      5
+#define DRIVER_STATS_SECTION_END      0xFF
+
+#if ((DRIVER_STATS_REQUEST_ID) >= (CMD_TABLE_SIZE))
+#error "DRIVER_STATS_REQUEST_ID must be a valid command table index"
+#endif
+
+//command table entry for the REQUEST frame
+#define DRIVER_STATS_REQUEST_ENTRY    { DriverStats_OnRequest, 2, 2 }
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//REQUEST frame handler, called by the command parser
+void DriverStats_OnRequest(uint8_t const * _payload, uint8_t _length);
+
+//send the requested report, main loop only
+unsigned char DriverStats_Poll(void);
+
+#endif /* _DRIVER_STATS_H_ */
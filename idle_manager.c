@@ -0,0 +1,411 @@
+
+#include <stddef.h>
+#include <assert.h>
+#include <adi_processor.h>
+#include <services/int/adi_int.h>
+#include <services/pwr/adi_pwr.h>
+#include <system.h>
+
+#include "common.h"
+#include "idle_manager.h"
+#include "clock_governor.h"
+
+#define RTC_CR0_RUN       (BITM_RTC_CR0_CNTEN | BITM_RTC_CR0_ALMINTEN)//counting, alarm interrupt armed
+#define RTC_START_LOOPS   100000u//polls for the first RTC count before giving up, several ticks at 26MHz
+
+//the instruction SRAM is not retained, hot code placed there does not survive hibernate
+#if (ADI_CFG_ISRAM_HOT_CODE == 1)
+#define IDLE_DEEPEST      IDLE_MODE_FLEXI
+#else
+#define IDLE_DEEPEST      IDLE_MODE_HIBERNATE
+#endif
+
+extern void Delay_ms(unsigned int mSec);//delay function, without the RTC
+
+ADI_INT_HANDLER(RTC1_Int_Handler);
+
+static const ADI_PWR_POWER_MODE PowerModes[IDLE_MODES] = { ADI_PWR_MODE_ACTIVE, ADI_PWR_MODE_FLEXI, ADI_PWR_MODE_HIBERNATE };
+static const char * const ModeNames[IDLE_MODES] = { "active", "flexi", "hibernate" };
+
+static bool_t   bReady = false;//RTC1 counts, sleeping is possible
+static uint8_t  Holds[IDLE_MODES];//outstanding Idle_Hold per mode
+static uint32_t Latency[IDLE_MODES];//worst wake-up latency in RTC ticks
+static uint64_t Ticks[IDLE_MODES];//RTC ticks slept per mode
+static uint64_t Total;//RTC ticks since Idle_Init
+static uint32_t Stamp;//RTC count of the last accounting
+static volatile bool_t bWake = false;//adi_pwr_EnterLowPowerMode flag, set by the alarm and Idle_Wake
+static volatile bool_t bWakeRequest = false;//Idle_Wake was called, ends Idle_Wait
+
+
+/********************************************************************
+* RTC1 access, writes are posted to the low frequency clock domain   *
+*********************************************************************/
+static void RtcSync(uint32_t _pending)
+{
+  while((pADI_RTC1->SR1 & _pending) != 0u)
+  {
+  }
+}
+
+static uint32_t RtcCount(void)
+{
+  uint16_t high;
+  uint16_t low;
+
+  //CNT1 may carry between the two reads
+  do
+  {
+    high = pADI_RTC1->CNT1;
+    low = pADI_RTC1->CNT0;
+  } while(high != pADI_RTC1->CNT1);
+
+  return ((uint32_t)high << 16) | low;
+}
+
+static void SetAlarm(uint32_t _count)
+{
+  RtcSync(BITM_RTC_SR1_WPNDALM0 | BITM_RTC_SR1_WPNDALM1 | BITM_RTC_SR1_WPNDCR0);
+  pADI_RTC1->ALM0 = (uint16_t)_count;
+  pADI_RTC1->ALM1 = (uint16_t)(_count >> 16);
+  pADI_RTC1->CR0 = RTC_CR0_RUN | BITM_RTC_CR0_ALMEN;
+
+  //the alarm only compares once the writes reached the RTC
+  while((pADI_RTC1->SR0 & (BITM_RTC_SR0_WSYNCALM0 | BITM_RTC_SR0_WSYNCALM1 | BITM_RTC_SR0_WSYNCCR0)) !=
+        (BITM_RTC_SR0_WSYNCALM0 | BITM_RTC_SR0_WSYNCALM1 | BITM_RTC_SR0_WSYNCCR0))
+  {
+  }
+}
+
+static void StopAlarm(void)
+{
+  RtcSync(BITM_RTC_SR1_WPNDCR0);
+  pADI_RTC1->CR0 = RTC_CR0_RUN;
+}
+
+
+/********************************************************************
+* RTC1 Interrupt, the alarm of Idle_Wait ends the sleep              *
+*********************************************************************/
+ADI_INT_HANDLER(RTC1_Int_Handler)
+{
+  if((pADI_RTC1->SR0 & BITM_RTC_SR0_ALMINT) != 0u)
+  {
+    RtcSync(BITM_RTC_SR1_WPNDSR0);
+    pADI_RTC1->SR0 = BITM_RTC_SR0_ALMINT;
+    adi_pwr_ExitLowPowerMode(&bWake);
+  }
+}
+
+
+/********************************************************************
+* Charge the RTC ticks since the last call to the total              *
+*********************************************************************/
+static void Account(void)
+{
+  uint32_t now = RtcCount();
+
+  Total += (uint32_t)(now - Stamp);
+  Stamp = now;
+}
+
+//shallowest mode held, IDLE_DEEPEST if none
+static uint8_t Allowed(void)
+{
+  uint8_t mode = IDLE_MODE_ACTIVE;
+
+  while((mode < IDLE_DEEPEST) && (Holds[mode] == 0u))
+    mode++;
+  return mode;
+}
+
+
+//consume a pending Idle_Wake, 1 if there was one
+static unsigned char Woken(void)
+{
+  if(!bWakeRequest)
+    return 0;
+  bWakeRequest = false;
+  return 1;
+}
+
+
+/********************************************************************
+* Sleep in _mode until the alarm at _alarm, or until Idle_Wake if    *
+* _timed is false. Returns the RTC count on wake-up.                 *
+*********************************************************************/
+static uint32_t Sleep(uint8_t _mode, uint32_t _alarm, bool_t _timed)
+{
+  uint32_t primask;
+  uint32_t start, end;
+
+  if(_timed)
+    SetAlarm(_alarm);
+
+  //an alarm already behind the count never fires, check it with the
+  //interrupts off up to the WFI
+  primask = __get_PRIMASK();
+  __disable_irq();
+  start = RtcCount();
+  if(!_timed || ((int32_t)(_alarm - start) > 0))
+  {
+    ClockGov_SleepBegin();
+    adi_pwr_EnterLowPowerMode(PowerModes[_mode], &bWake, 0u);
+    ClockGov_SleepEnd();
+  }
+  end = RtcCount();
+  __set_PRIMASK(primask);
+
+  Ticks[_mode] += (uint32_t)(end - start);
+  if(_timed)
+    StopAlarm();
+  return end;
+}
+
+
+/********************************************************************
+* Measure the wake-up latency of _mode                               *
+*********************************************************************/
+static void Calibrate(uint8_t _mode)
+{
+  uint32_t i;
+  uint32_t alarm, ticks;
+  uint32_t min = 0xFFFFFFFFu, max = 0u, sum = 0u;
+
+  for(i = 0; i < IDLE_CAL_RUNS; i++)
+  {
+    alarm = RtcCount() + IDLE_CAL_TICKS;
+    ticks = Sleep(_mode, alarm, true) - alarm;
+    if((int32_t)ticks < 0)
+      ticks = 0u;
+
+    if(ticks < min)
+      min = ticks;
+    if(ticks > max)
+      max = ticks;
+    sum += ticks;
+  }
+
+  //a started tick counts as a whole one
+  Latency[_mode] = max + 1u;
+  DEBUG_MESSAGE("idle,latency,%s,%u,%u,%u,%u\n", ModeNames[_mode], IDLE_CAL_RUNS,
+                (min * 15625u) / 512u, ((sum * 15625u) / 512u) / IDLE_CAL_RUNS, (max * 15625u) / 512u);
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Init
+* Description  : This function starts RTC1 as the wake-up timer, keeps all the data SRAM
+*                through hibernate and measures the wake-up latency of each mode, see
+*                idle_manager.h. Call it once after ClockGov_Init and before the peripherals
+*                are opened, the measurement sleeps IDLE_CAL_RUNS times per mode.
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (SRAM retention not set or RTC1 does not count, Idle_Wait will not sleep)
+**********************************************************************************************/
+unsigned char Idle_Init(void)
+{
+  uint32_t i;
+  uint32_t count;
+
+  //bank 0 is always retained, SRAMRET is behind the PWRKEY
+  if(adi_system_EnableRetention(ADI_SRAM_BANK_1, true) != SUCCESS)
+    return 1;
+  if(adi_system_EnableRetention(ADI_SRAM_BANK_2, true) != SUCCESS)
+    return 1;
+
+  //RTC1 from zero at the undivided low frequency clock, only the alarm interrupt
+  RtcSync(BITM_RTC_SR1_WPNDCR0);
+  pADI_RTC1->CR0 = 0u;
+  while((pADI_RTC1->SR2 & BITM_RTC_SR2_WPNDCR1MIR) != 0u)
+  {
+  }
+  pADI_RTC1->CR1 = 0u;
+  RtcSync(BITM_RTC_SR1_WPNDCNT0 | BITM_RTC_SR1_WPNDCNT1 | BITM_RTC_SR1_WPNDSR0);
+  pADI_RTC1->CNT0 = 0u;
+  pADI_RTC1->CNT1 = 0u;
+  pADI_RTC1->SR0 = BITM_RTC_SR0_ALMINT;
+  RtcSync(BITM_RTC_SR1_WPNDCR0);
+  pADI_RTC1->CR0 = RTC_CR0_RUN;
+
+  ADI_INSTALL_HANDLER(RTC1_EVT_IRQn, RTC1_Int_Handler);
+  ADI_ENABLE_INT(RTC1_EVT_IRQn);
+
+  //without the low frequency clock the count never moves
+  count = RtcCount();
+  for(i = 0; (i < RTC_START_LOOPS) && (RtcCount() == count); i++)
+  {
+  }
+  if(i == RTC_START_LOOPS)
+    return 1;
+
+  for(i = 0; i < IDLE_MODES; i++)
+  {
+    Holds[i] = 0u;
+    Latency[i] = 0u;
+  }
+  for(i = IDLE_MODE_FLEXI; i <= IDLE_DEEPEST; i++)
+    Calibrate((uint8_t)i);
+
+  //the residency starts after the measurement
+  for(i = 0; i < IDLE_MODES; i++)
+    Ticks[i] = 0u;
+  Total = 0u;
+  Stamp = RtcCount();
+  bReady = true;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Hold
+* Description  : This function keeps Idle_Wait from sleeping deeper than _mode until the hold
+*                is released, for a driver that needs its clock meanwhile. Holds nest.
+* Arguments    : uint8_t _mode = deepest mode the driver can bear, IDLE_MODE_xxx
+* Return Value : 0 = Success
+*                1 = Failure (invalid mode)
+**********************************************************************************************/
+unsigned char Idle_Hold(uint8_t _mode)
+{
+  assert(__get_IPSR() == 0u);
+  if(_mode >= IDLE_MODES)
+    return 1;
+
+  Holds[_mode]++;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Release
+* Description  : This function releases a hold of Idle_Hold
+* Arguments    : uint8_t _mode = mode passed to Idle_Hold
+* Return Value : 0 = Success
+*                1 = Failure (mode not held)
+**********************************************************************************************/
+unsigned char Idle_Release(uint8_t _mode)
+{
+  assert(__get_IPSR() == 0u);
+  if((_mode >= IDLE_MODES) || (Holds[_mode] == 0u))
+    return 1;
+
+  Holds[_mode]--;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Wait
+* Description  : This function sleeps until _ms have passed or Idle_Wake is called. Each sleep
+*                takes the deepest mode allowed by the holds whose wake-up latency fits before
+*                the deadline, and is woken that latency early. Interrupts that do not call
+*                Idle_Wake are served and the core sleeps again. It returns at once when held
+*                in IDLE_MODE_ACTIVE, and once the deadline is too close for a sleep, the
+*                caller polls instead. Without a running RTC it spins with Delay_ms.
+* Arguments    : uint32_t _ms = time to wait, below 2^31 RTC ticks (18 hours), or IDLE_FOREVER
+* Return Value : 0 = Deadline reached, or no sleep possible
+*                1 = Ended by Idle_Wake
+**********************************************************************************************/
+unsigned char Idle_Wait(uint32_t _ms)
+{
+  bool_t timed = (bool_t)(_ms != IDLE_FOREVER);
+  uint32_t deadline = 0u;
+  uint32_t left = 0xFFFFFFFFu;
+  uint8_t mode;
+
+  assert(__get_IPSR() == 0u);
+  if(!bReady)
+  {
+    if(timed)
+      Delay_ms(_ms);
+    while(!timed && !bWakeRequest)
+    {
+    }
+    return Woken();
+  }
+
+  if(timed)
+    deadline = RtcCount() + (uint32_t)(((uint64_t)_ms * IDLE_RTC_HZ) / 1000u);
+
+  while(!bWakeRequest)
+  {
+    if(timed)
+    {
+      left = deadline - RtcCount();
+      if((int32_t)left <= 0)
+        break;
+    }
+
+    mode = Allowed();
+    while((mode > IDLE_MODE_ACTIVE) && (left <= (Latency[mode] + IDLE_MIN_TICKS)))
+      mode--;
+
+    //too close to the deadline to sleep, or held awake
+    if(mode == IDLE_MODE_ACTIVE)
+      break;
+
+    Sleep(mode, deadline - Latency[mode], timed);
+  }
+  return Woken();
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Wake
+* Description  : This function ends the current Idle_Wait, or the next one if none is running
+* Arguments    : void
+* Return Value : void
+**********************************************************************************************/
+void Idle_Wake(void)
+{
+  bWakeRequest = true;
+  adi_pwr_ExitLowPowerMode(&bWake);
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Ticks
+* Description  : This function returns the RTC1 count, the timebase of the sleeps
+* Arguments    : void
+* Return Value : RTC ticks since Idle_Init started RTC1, IDLE_RTC_HZ per second
+**********************************************************************************************/
+uint32_t Idle_Ticks(void)
+{
+  return RtcCount();
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_Residency
+* Description  : This function returns the time spent in a mode since Idle_Init, the active
+*                time is the time not slept
+* Arguments    : uint8_t _mode = IDLE_MODE_xxx
+* Return Value : time in ms, 0 for an invalid mode
+**********************************************************************************************/
+uint32_t Idle_Residency(uint8_t _mode)
+{
+  uint64_t ticks;
+
+  if(_mode >= IDLE_MODES)
+    return 0;
+
+  Account();
+  ticks = Ticks[_mode];
+  if(_mode == IDLE_MODE_ACTIVE)
+    ticks = Total - Ticks[IDLE_MODE_FLEXI] - Ticks[IDLE_MODE_HIBERNATE];
+  return (uint32_t)((ticks * 1000u) / IDLE_RTC_HZ);
+}
+
+
+/**********************************************************************************************
+* Function Name: Idle_WakeLatency
+* Description  : This function returns the worst wake-up latency measured by Idle_Init
+* Arguments    : uint8_t _mode = IDLE_MODE_xxx
+* Return Value : latency in us, 0 for IDLE_MODE_ACTIVE, an invalid or an unmeasured mode
+**********************************************************************************************/
+uint32_t Idle_WakeLatency(uint8_t _mode)
+{
+  if(_mode >= IDLE_MODES)
+    return 0;
+
+  return (Latency[_mode] * 15625u) / 512u;
+}
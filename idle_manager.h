@@ -0,0 +1,88 @@
+
+#ifndef _IDLE_MANAGER_H_
+#define _IDLE_MANAGER_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+
+
+/******************************************************************************/
+/* idle manager parameters                                                    */
+/******************************************************************************/
+
+/*
+ * Low power waits. Idle_Wait sleeps until a deadline or an Idle_Wake, in the
+ * deepest mode that suits the peripherals in use and the time left:
+ *
+ *   FLEXI      core clock stopped, peripherals and DMA keep running
+ *   HIBERNATE  HFOSC and the peripheral clocks stopped, SRAM retained,
+ *              only the RTC and the external interrupts wake the core
+ *
+ * A driver that needs its clock while the core sleeps holds the deepest mode
+ * it can bear with Idle_Hold, e.g. IDLE_MODE_FLEXI while a UART is open, and
+ * releases it with Idle_Release. IDLE_MODE_ACTIVE keeps the core awake.
+ * SHUTDOWN is not used, it loses the SRAM and wakes through a reset.
+ *
+ * RTC1 counts IDLE_RTC_HZ from the low frequency clock and wakes the core
+ * at the deadline. Idle_Init measures the wake-up latency of each mode,
+ * the time from the RTC alarm to the core running again, IDLE_CAL_RUNS times,
+ * and prints it once:
+ *
+ *   idle,latency,<flexi|hibernate>,<runs>,<min us>,<avg us>,<max us>
+ *
+ * The alarm of a wait is set that much before the deadline and a mode is only
+ * entered if the deadline leaves time for its wake-up. The latency resolution
+ * is one RTC tick, about 31us.
+ *
+ * The residency of each mode counts from Idle_Init in RTC ticks, the active
+ * residency is the time not spent in Idle_Wait sleeps. The DWT cycle counter
+ * stops while the core sleeps, each sleep hands the clock governor timebase
+ * (ClockGov_Cycles) over to the RTC count.
+ *
+ * Idle_Wait does not sleep while IDLE_MODE_ACTIVE is held, nor once the
+ * deadline is closer than the FLEXI wake-up latency. It returns straight
+ * away then and the caller decides how to poll.
+ */
+#define IDLE_RTC_HZ             32768u       //RTC1 count rate, the low frequency clock undivided
+#define IDLE_MIN_TICKS          4u           //shortest sleep, covers the RTC posted write of the alarm
+#define IDLE_CAL_RUNS           8            //sleeps per mode in the wake-up latency measurement
+#define IDLE_CAL_TICKS          64u          //length of each measurement sleep, about 2ms
+#define IDLE_FOREVER            0xFFFFFFFFu  //Idle_Wait without deadline, only Idle_Wake ends it
+
+//modes, in increasing depth
+#define IDLE_MODE_ACTIVE        0
+#define IDLE_MODE_FLEXI         1
+#define IDLE_MODE_HIBERNATE     2
+#define IDLE_MODES              3
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//start RTC1, retain the SRAM in hibernate and measure the wake-up latencies, after ClockGov_Init and before the peripherals are opened
+unsigned char Idle_Init(void);
+
+//keep Idle_Wait at _mode or shallower until the matching Idle_Release, main loop only
+unsigned char Idle_Hold(uint8_t _mode);
+unsigned char Idle_Release(uint8_t _mode);
+
+//sleep for _ms or until Idle_Wake, returns 1 after an Idle_Wake, main loop only
+unsigned char Idle_Wait(uint32_t _ms);
+
+//end the current or the next Idle_Wait, any context
+void Idle_Wake(void);
+
+//RTC1 count, any context
+uint32_t Idle_Ticks(void);
+
+//time spent in _mode since Idle_Init, in ms
+uint32_t Idle_Residency(uint8_t _mode);
+
+//worst wake-up latency of _mode measured by Idle_Init, in us
+uint32_t Idle_WakeLatency(uint8_t _mode);
+
+#endif /* _IDLE_MANAGER_H_ */
@@ -36,6 +36,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -62,7 +63,7 @@ extern char_t aDebugString[150];
 
 #define DEBUG_MESSAGE(...) \
   do { \
-    sprintf(aDebugString,__VA_ARGS__); \
+    test_Format(aDebugString, sizeof(aDebugString), __VA_ARGS__); \
     test_Perf(aDebugString); \
   } while(0)
 
@@ -73,9 +74,9 @@ extern char_t aDebugString[150];
 #define DEBUG_RESULT(s,result,expected_value) \
   do { \
     if ((result) != (expected_value)) { \
-      sprintf(aDebugString,"%s  %d", __FILE__,__LINE__); \
+      test_Format(aDebugString, sizeof(aDebugString), "%s  %d", __FILE__,__LINE__); \
       test_Fail(aDebugString); \
-      sprintf(aDebugString,"%s Error Code: 0x%08X\n\rFailed\n\r",(s),(result)); \
+      test_Format(aDebugString, sizeof(aDebugString), "%s Error Code: 0x%08X\n\rFailed\n\r",(s),(result)); \
       test_Perf(aDebugString); \
       exit(0); \
     } \
@@ -88,6 +89,8 @@ void test_Init(void);
 void test_Pass(void);
 void test_Fail(char *FailureReason);
 void test_Perf(char *InfoString);
+int32_t test_Format(char_t *pBuf, uint32_t nSize, const char_t *pFormat, ...);
+int32_t test_VFormat(char_t *pBuf, uint32_t nSize, const char_t *pFormat, va_list args);
 
 #ifdef __cplusplus
 }
@@ -80,6 +80,30 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #if (ADI_CFG_ENTER_LOW_PWR_MODE_SUPPORT ==1 ) && (ADI_CFG_ENABLE_RTOS_SUPPORT == 1)
 #error " Low power mode supported only in NON-RTOS environment"
 #endif
+
+/*! Set this macro to 1 to record the interrupt handler boundaries and the driver
+    submit/completion points in a cycle stamped trace buffer, see adi_trace.h */
+#define ADI_CFG_ENABLE_TRACE                              0
+
+/*! Number of trace records kept, the oldest are overwritten. Must be a power of two. */
+#define ADI_CFG_TRACE_SIZE                                256
+
+/*! Set this macro to 1 to count the driver traffic, errors and interrupt handler
+    time, see adi_stats.h */
+#define ADI_CFG_ENABLE_STATS                              0
+
+/*! Set this macro to 1 to time the critical regions per call site and the GPIO
+    interrupt latency, see adi_latency.h. Not available with RTOS support. */
+#define ADI_CFG_ENABLE_LATENCY                            0
+
+#if (ADI_CFG_ENABLE_LATENCY == 1) && (ADI_CFG_ENABLE_RTOS_SUPPORT == 1)
+#error " Latency measurement supported only in NON-RTOS environment"
+#endif
+
+/*! Set this macro to 1 to run the hot interrupt handlers and loops marked
+    ADI_ISRAM_CODE (adi_int.h) from instruction SRAM instead of flash. Needs
+    a linker file with the .isram_code section, see temperature_sensor.icf */
+#define ADI_CFG_ISRAM_HOT_CODE                            0
 /*! @} */
 
 #endif /* __ADI_GLOBAL_CONFIG_H__ */
@@ -71,15 +71,15 @@ typedef void *ADI_I2C_HANDLE;
 /*! The amount of application supplied memory required by the I2C driver. */
 #if (ADI_I2C_CFG_ENABLE_DMA_SUPPORT == 1)
 #if (ADI_CFG_ENABLE_RTOS_SUPPORT == 1)
-#define ADI_I2C_MEMORY_SIZE (288u)
+#define ADI_I2C_MEMORY_SIZE (296u)
 #else
-#define ADI_I2C_MEMORY_SIZE (224u)
+#define ADI_I2C_MEMORY_SIZE (232u)
 #endif
 #else
 #if (ADI_CFG_ENABLE_RTOS_SUPPORT == 1)
-#define ADI_I2C_MEMORY_SIZE (184u)
+#define ADI_I2C_MEMORY_SIZE (192u)
 #else
-#define ADI_I2C_MEMORY_SIZE (120u)
+#define ADI_I2C_MEMORY_SIZE (128u)
 #endif
 #endif
 
@@ -146,6 +146,7 @@ typedef enum
 	ADI_I2C_EVENT_DNAK,                    /*!< The transfer was aborted due to the detection of a NAK during data transmission. */
 	ADI_I2C_EVENT_ANAK,                    /*!< The transfer was aborted due to the detection of a NAK during the address phase of the transfer. */
 	ADI_I2C_EVENT_LOSTARB,                 /*!< The current transfer was aborted due to the loss of arbitration with another master. */
+    ADI_I2C_EVENT_LIST_PROCESSED,          /*!< A transaction list completed or was aborted. The argument is the #ADI_I2C_RESULT of the list. */
 }ADI_I2C_EVENT;
 
 /*! Enum to distinguish the different general call event occurred.
@@ -165,6 +166,19 @@ typedef enum
 } ADI_I2C_HWADDR_WIDTH;
 
 
+/*! A single operation of a I2C transaction list. The optional write phase is
+ *  followed by the optional read phase on the same slave. */
+typedef struct
+{
+    uint8_t            *pTxBuffer;          /*!< Data to write (e.g. the register address), NULL if nTxSize is 0 */
+    uint8_t            *pRxBuffer;          /*!< Buffer for the data read, NULL if nRxSize is 0 */
+    uint16_t            nSlaveAddr;         /*!< Slave address of the operation */
+    uint16_t            nTxSize;            /*!< Number of bytes to write */
+    uint16_t            nRxSize;            /*!< Number of bytes to read (256 maximum) */
+    bool_t              bRestart;           /*!< true for a repeated start between the write and the read, false for STOP/START */
+} ADI_I2C_TRANSACTION;
+
+
 /*
  * Open a I2C device instance.
  */
@@ -271,6 +285,34 @@ ADI_I2C_RESULT adi_i2c_Read(
     uint32_t               const nBufSize
 );
 
+/*
+ * Write then read a I2C device using a repeated start (blocking).
+ */
+ADI_I2C_RESULT adi_i2c_WriteRead(
+    ADI_I2C_HANDLE         const hDevice,
+    void                        *pTxBuffer,
+    uint32_t               const nTxSize,
+    void                        *pRxBuffer,
+    uint32_t               const nRxSize
+);
+
+/*
+ * Submit a list of transactions (non-blocking).
+ */
+ADI_I2C_RESULT adi_i2c_SubmitTransactionList(
+    ADI_I2C_HANDLE              const hDevice,
+    ADI_I2C_TRANSACTION const * const pList,
+    uint32_t                    const nCount
+);
+
+/*
+ * Wait for a transaction list to complete and return its result.
+ */
+ADI_I2C_RESULT adi_i2c_GetTransactionListResult(
+    ADI_I2C_HANDLE         const hDevice,
+    uint32_t             * const pnCompleted
+);
+
 /*
  * Set the I2C serial clock bit rate.
  */
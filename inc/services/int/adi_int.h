@@ -76,6 +76,23 @@ typedef void (*ADI_INT_HANDLER_PTR)(
 
 #else /* No multithread support */
 
+#if (ADI_CFG_ENABLE_LATENCY == 1)
+
+#include <services/latency/adi_latency.h>
+
+/* Enter critical region, timed per call site */
+#define ADI_ENTER_CRITICAL_REGION()  \
+        do { \
+            static ADI_LATENCY_SITE adi_latency_Site = { NULL, __FILE__, __LINE__ }; \
+            adi_latency_CsEnter(&adi_latency_Site); \
+        } while (0)
+
+/* Exit critical region */
+#define ADI_EXIT_CRITICAL_REGION()  \
+        adi_latency_CsExit()
+
+#else
+
 /* Enter critical region */
 #define ADI_ENTER_CRITICAL_REGION()  \
         __disable_irq()
@@ -84,6 +101,8 @@ typedef void (*ADI_INT_HANDLER_PTR)(
 #define ADI_EXIT_CRITICAL_REGION()  \
         __enable_irq()
 
+#endif /* ADI_CFG_ENABLE_LATENCY */
+
 /* Used to define the interrupt handler */
 #define ADI_INT_HANDLER(Handler) \
         void (Handler)(void)
@@ -107,6 +126,19 @@ typedef void (*ADI_INT_HANDLER_PTR)(void);
 
 #endif  /* ADI_CFG_ENABLE_RTOS_SUPPORT */
 
+/* Place the function defined next in instruction SRAM (ADI_CFG_ISRAM_HOT_CODE) */
+#if (ADI_CFG_ISRAM_HOT_CODE == 1) && defined(__ICCARM__)
+#define ADI_ISRAM_CODE  _Pragma("location=\".isram_code\"")
+#else
+#define ADI_ISRAM_CODE
+#endif
+
+/* Address range of the instruction SRAM, to tell where a function runs from */
+#define ADI_ISRAM_BASE  0x10000000u
+#define ADI_ISRAM_SIZE  0x00008000u
+#define ADI_IN_ISRAM(_addr) \
+        (((uint32_t)(_addr) >= ADI_ISRAM_BASE) && ((uint32_t)(_addr) < (ADI_ISRAM_BASE + ADI_ISRAM_SIZE)))
+
 /*! Enumeration of different error codes returned by adi_int* APIs. */
 typedef enum
 {
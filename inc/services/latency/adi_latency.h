@@ -0,0 +1,105 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_latency.h
+ * @brief:   Interrupt masking and GPIO interrupt latency measurement
+ *-----------------------------------------------------------------------------
+ *
+ * Enabled with ADI_CFG_ENABLE_LATENCY in adi_global_config.h, for builds
+ * without RTOS support.
+ *
+ * Critical sections: ADI_ENTER_CRITICAL_REGION() / ADI_EXIT_CRITICAL_REGION()
+ * time every region with the DWT cycle counter. Each call site gets its own
+ * ADI_LATENCY_SITE, linked into the list of adi_latency_GetSites() the first
+ * time it completes, with the call count, the longest region and a histogram
+ * of the region lengths. A region entered with interrupts already masked is
+ * part of the enclosing one, and its exit ends the enclosing one as the plain
+ * __enable_irq() does.
+ *
+ * GPIO interrupts: the latency from a trigger stamped by adi_latency_Arm()
+ * to the handler entry and to the callback, per GPIO driver interrupt
+ * (ADI_LATENCY_IRQ_xxx). Only armed interrupts are measured, one at a time.
+ *
+ * Histogram bucket 0 counts lengths below 32 cycles, bucket N the lengths
+ * from 16 << N up to 32 << N cycles and the last bucket everything longer.
+ * The measurement adds about 20 cycles to each region and each handler.
+ *
+ *****************************************************************************/
+
+#ifndef __ADI_LATENCY_H__
+#define __ADI_LATENCY_H__
+
+#include <stddef.h>
+#include <adi_types.h>
+#include <adi_global_config.h>
+
+/** @addtogroup Latency_Service Latency Measurement Service
+ *  @{
+ */
+
+#define ADI_LATENCY_BUCKETS     (8u)    /*!< Histogram buckets              */
+
+/* GPIO driver interrupts, in the order of its callback table */
+#define ADI_LATENCY_IRQ_EXT0    (0u)    /*!< External interrupt 0           */
+#define ADI_LATENCY_IRQ_EXT1    (1u)    /*!< External interrupt 1           */
+#define ADI_LATENCY_IRQ_EXT2    (2u)    /*!< External interrupt 2           */
+#define ADI_LATENCY_IRQ_EXT3    (3u)    /*!< External interrupt 3           */
+#define ADI_LATENCY_IRQ_GROUPA  (4u)    /*!< GPIO group A                   */
+#define ADI_LATENCY_IRQ_GROUPB  (5u)    /*!< GPIO group B                   */
+#define ADI_LATENCY_NUM_IRQ     (6u)    /*!< Measured interrupts            */
+
+/*! Critical section call site */
+typedef struct ADI_LATENCY_SITE
+{
+    struct ADI_LATENCY_SITE *pNext;             /*!< Next site seen         */
+    const char              *pFile;             /*!< Source file            */
+    uint32_t                 nLine;             /*!< Source line            */
+    uint32_t                 nCount;            /*!< Regions completed      */
+    uint32_t                 nMaxCycles;        /*!< Longest region         */
+    uint32_t                 aHistogram[ADI_LATENCY_BUCKETS]; /*!< Region lengths */
+} ADI_LATENCY_SITE;
+
+/*! Latency distribution, in core cycles */
+typedef struct
+{
+    uint32_t nCount;                            /*!< Measurements           */
+    uint32_t nMinCycles;                        /*!< Shortest               */
+    uint32_t nMaxCycles;                        /*!< Longest                */
+    uint32_t aHistogram[ADI_LATENCY_BUCKETS];   /*!< All of them            */
+} ADI_LATENCY_DIST;
+
+/*! Latency of one GPIO interrupt, from the trigger */
+typedef struct
+{
+    ADI_LATENCY_DIST Entry;                     /*!< To the handler entry   */
+    ADI_LATENCY_DIST Callback;                  /*!< To the callback call   */
+} ADI_LATENCY_IRQ;
+
+#if (ADI_CFG_ENABLE_LATENCY == 1)
+
+/*! GPIO interrupt latencies, indexed by ADI_LATENCY_IRQ_xxx */
+extern ADI_LATENCY_IRQ adi_latency_Irq[ADI_LATENCY_NUM_IRQ];
+
+/*! Handler entry of GPIO interrupt N, first statement of the handler */
+#define ADI_LATENCY_IRQ_ENTRY(N)        adi_latency_IrqEntry(N)
+
+/*! Callback of GPIO interrupt N, just before the call */
+#define ADI_LATENCY_IRQ_CALLBACK(N)     adi_latency_IrqCallback(N)
+
+void adi_latency_CsEnter (ADI_LATENCY_SITE *const pSite);
+void adi_latency_CsExit (void);
+ADI_LATENCY_SITE *adi_latency_GetSites (void);
+void adi_latency_Arm (uint32_t const nIrq);
+void adi_latency_IrqEntry (uint32_t const nIrq);
+void adi_latency_IrqCallback (uint32_t const nIrq);
+void adi_latency_Reset (void);
+
+#else
+
+#define ADI_LATENCY_IRQ_ENTRY(N)
+#define ADI_LATENCY_IRQ_CALLBACK(N)
+
+#endif /* ADI_CFG_ENABLE_LATENCY */
+
+/*! @} */
+
+#endif /* __ADI_LATENCY_H__ */
@@ -0,0 +1,119 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_stats.h
+ * @brief:   Driver performance counters
+ *-----------------------------------------------------------------------------
+ *
+ * Enabled with ADI_CFG_ENABLE_STATS in adi_global_config.h. When enabled,
+ * the drivers count the traffic and the errors they see, and ISR_PROLOG() /
+ * ISR_EPILOG() count the calls and core cycles of every interrupt handler, so
+ * the GPIO and DMA interrupts are covered by the per IRQ counters.
+ *
+ * Each counter has a single writer (one driver path, either interrupt or
+ * thread context) and is a plain 32 bit increment. Read them through
+ * adi_stats_Snapshot(), which copies the whole block in one masked section.
+ * When the counters are disabled every ADI_STATS_*() expands to nothing.
+ *
+ *****************************************************************************/
+
+#ifndef __ADI_STATS_H__
+#define __ADI_STATS_H__
+
+#include <adi_types.h>
+#include <adi_global_config.h>
+
+/** @addtogroup Stats_Service Driver Statistics Service
+ *  @{
+ */
+
+#define ADI_STATS_NUM_SPI       (3u)    /*!< SPI devices                    */
+#define ADI_STATS_NUM_DMA       (24u)   /*!< DMA channels                   */
+#define ADI_STATS_NUM_IRQ       (64u)   /*!< Device interrupts (IRQn)       */
+
+/*! UART counters */
+typedef struct
+{
+    uint32_t nTxBuffers;            /*!< Transmit buffers completed         */
+    uint32_t nTxBytes;              /*!< Bytes of the completed buffers     */
+    uint32_t nRxBuffers;            /*!< Receive buffers completed          */
+    uint32_t nRxBytes;              /*!< Bytes of the completed buffers     */
+    uint32_t nFramingErrors;        /*!< Line status framing errors         */
+    uint32_t nParityErrors;         /*!< Line status parity errors          */
+    uint32_t nOverrunErrors;        /*!< Line status overrun errors         */
+    uint32_t nBreaks;               /*!< Break conditions                   */
+} ADI_STATS_UART;
+
+/*! SPI counters, one block per device */
+typedef struct
+{
+    uint32_t nTransfers;            /*!< Master transfers started           */
+    uint32_t nTxBytes;              /*!< Bytes to transmit                  */
+    uint32_t nRxBytes;              /*!< Bytes to receive                   */
+    uint32_t nRxOverflows;          /*!< Receive FIFO overflows             */
+    uint32_t nTxUnderflows;         /*!< Transmit FIFO underflows           */
+} ADI_STATS_SPI;
+
+/*! I2C master counters */
+typedef struct
+{
+    uint32_t nLists;                /*!< Transaction lists started          */
+    uint32_t nTransactions;         /*!< Transactions completed             */
+    uint32_t nBytes;                /*!< Bytes of the completed transactions */
+    uint32_t nFailedLists;          /*!< Lists aborted by an error          */
+    uint32_t nNackAddr;             /*!< Address NACKs                      */
+    uint32_t nNackData;             /*!< Data NACKs                         */
+    uint32_t nArbLost;              /*!< Arbitration lost                   */
+} ADI_STATS_I2C;
+
+/*! DMA counters, one block per channel */
+typedef struct
+{
+    uint32_t nDone;                 /*!< Channel done interrupts            */
+    uint32_t nErrors;               /*!< Bus errors and invalid descriptors */
+} ADI_STATS_DMA;
+
+/*! Interrupt handler counters, one block per IRQn. Nested handlers are
+    included in the cycles of the handler they interrupted. */
+typedef struct
+{
+    uint32_t nCalls;                /*!< Handler calls                      */
+    uint32_t nCycles;               /*!< Core cycles spent in the handler   */
+    uint32_t nMaxCycles;            /*!< Longest call                       */
+    uint32_t nMinCycles;            /*!< Shortest call                      */
+} ADI_STATS_ISR;
+
+/*! All counters */
+typedef struct
+{
+    ADI_STATS_UART Uart;
+    ADI_STATS_SPI  Spi[ADI_STATS_NUM_SPI];
+    ADI_STATS_I2C  I2c;
+    ADI_STATS_DMA  Dma[ADI_STATS_NUM_DMA];
+    ADI_STATS_ISR  Isr[ADI_STATS_NUM_IRQ];
+} ADI_STATS;
+
+#if (ADI_CFG_ENABLE_STATS == 1)
+
+/*! The live counters, only the drivers write them */
+extern ADI_STATS adi_stats_Data;
+
+/*! Count one event */
+#define ADI_STATS_INC(FIELD)        (adi_stats_Data.FIELD++)
+
+/*! Count N units */
+#define ADI_STATS_ADD(FIELD, N)     (adi_stats_Data.FIELD += (uint32_t)(N))
+
+void adi_stats_Snapshot (ADI_STATS *const pCopy, bool_t const bReset);
+uint32_t adi_stats_IsrBegin (void);
+void adi_stats_IsrEnd (uint32_t const nStart);
+
+#else
+
+#define ADI_STATS_INC(FIELD)
+#define ADI_STATS_ADD(FIELD, N)
+
+#endif /* ADI_CFG_ENABLE_STATS */
+
+/*! @} */
+
+#endif /* __ADI_STATS_H__ */
@@ -380,7 +380,7 @@ ADI_TMR_RESULT adi_tmr_GetLoadValue(
 	           uint16_t *pTimerLdVal
 	           );
 
-ADI_TMR_RESULT adi_GPT_GetCurrentValue(
+ADI_TMR_RESULT adi_tmr_GetCurrentValue(
 	           ADI_TMR_HANDLE hDevice,
 	           uint16_t *pTimerValue
 	           );
@@ -0,0 +1,92 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_trace.h
+ * @brief:   Cycle stamped event trace for the drivers and interrupt handlers
+ *-----------------------------------------------------------------------------
+ *
+ * Enabled with ADI_CFG_ENABLE_TRACE in adi_global_config.h. When enabled,
+ * every interrupt handler records its entry and exit through ISR_PROLOG() and
+ * ISR_EPILOG(), and the drivers record their submit and completion points.
+ * Records are kept in a circular buffer that overwrites the oldest entries,
+ * adi_trace_Buffer is read with the debugger (or dumped by the application)
+ * and turned into a timeline by tools/trace_decode.py.
+ *
+ * When the trace is disabled every ADI_TRACE() expands to nothing.
+ *
+ *****************************************************************************/
+
+#ifndef __ADI_TRACE_H__
+#define __ADI_TRACE_H__
+
+#include <adi_types.h>
+#include <adi_global_config.h>
+
+/** @addtogroup Trace_Service Event Trace Service
+ *  @{
+ */
+
+/*! Marks a valid trace buffer in a memory dump ("TRCE") */
+#define ADI_TRACE_MAGIC         (0x45435254u)
+
+/*! Trace events. The names are read by tools/trace_decode.py: _BEGIN/_END
+    pairs become durations, everything else an instant event. Only append. */
+typedef enum
+{
+    ADI_TRACE_ISR_BEGIN,            /*!< Interrupt handler entry, argument = exception number (IPSR) */
+    ADI_TRACE_ISR_END,              /*!< Interrupt handler exit, argument = exception number (IPSR)  */
+    ADI_TRACE_UART_SUBMIT_TX,       /*!< adi_uart_SubmitTxBuffer(), argument = bytes                 */
+    ADI_TRACE_UART_SUBMIT_RX,       /*!< adi_uart_SubmitRxBuffer(), argument = bytes                 */
+    ADI_TRACE_I2C_LIST_BEGIN,       /*!< I2C transaction list started, argument = transactions       */
+    ADI_TRACE_I2C_LIST_END,         /*!< I2C transaction list complete, argument = transactions left */
+    ADI_TRACE_I2C_XFER,             /*!< I2C transaction started, argument = transactions left       */
+    ADI_TRACE_I2C_MSTAT,            /*!< I2C master interrupt, argument = MSTAT                      */
+    ADI_TRACE_SPI_XFER,             /*!< adi_spi_MasterTransfer(), argument = transmit bytes         */
+    ADI_TRACE_DMA_DONE,             /*!< DMA channel done, argument = channel number                 */
+    ADI_TRACE_APP_BEGIN,            /*!< Application phase entry, argument = phase                   */
+    ADI_TRACE_APP_END,              /*!< Application phase exit, argument = phase                    */
+    ADI_TRACE_APP_MARK,             /*!< Application event, argument = application defined           */
+    ADI_TRACE_CLOCK_DIV,            /*!< HCLK divider changed, argument = new divider of the root clock */
+    ADI_TRACE_EVENT_COUNT
+} ADI_TRACE_EVENT;
+
+/*! One trace record */
+typedef struct
+{
+    uint32_t nCycles;               /*!< DWT cycle count                */
+    uint16_t nEvent;                /*!< ADI_TRACE_EVENT                */
+    uint16_t nArg;                  /*!< Event argument                 */
+} ADI_TRACE_RECORD;
+
+/*! Trace buffer, laid out for a memory dump (little endian) */
+typedef struct
+{
+    uint32_t          nMagic;       /*!< ADI_TRACE_MAGIC once started           */
+    uint32_t          nSize;        /*!< Records in aRecords                    */
+    volatile uint32_t nWritten;     /*!< Records written since adi_trace_Start  */
+    uint32_t          nClock;       /*!< HCLK in Hz, scales the cycle counts    */
+    volatile uint32_t bEnabled;     /*!< Recording, cleared by adi_trace_Stop() */
+    ADI_TRACE_RECORD  aRecords[ADI_CFG_TRACE_SIZE];
+} ADI_TRACE_BUFFER;
+
+#if (ADI_CFG_ENABLE_TRACE == 1)
+
+/*! The trace buffer, dump sizeof(adi_trace_Buffer) bytes from its address */
+extern ADI_TRACE_BUFFER adi_trace_Buffer;
+
+/*! Record an event, from any context */
+#define ADI_TRACE(EVENT, ARG)   adi_trace_Record((EVENT), (uint32_t)(ARG))
+
+void adi_trace_Start (void);
+void adi_trace_Stop (void);
+void adi_trace_Record (ADI_TRACE_EVENT const eEvent, uint32_t const nArg);
+void adi_trace_Isr (ADI_TRACE_EVENT const eEvent);
+
+#else
+
+#define ADI_TRACE(EVENT, ARG)
+
+#endif /* ADI_CFG_ENABLE_TRACE */
+
+/*! @} */
+
+#endif /* __ADI_TRACE_H__ */
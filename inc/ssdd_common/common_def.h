@@ -103,10 +103,6 @@ extern "C" {
                    return(RESULT);\
                 }\
                 
-#define  ISR_PROLOG()
-                
-#define  ISR_EPILOG()
-
 /* IF (Low Power Mode is enabled) */
 #elif (ADI_CFG_ENTER_LOW_PWR_MODE_SUPPORT == 1)
 
@@ -120,10 +116,6 @@ extern "C" {
 #define POST_EVENT(DEV)                                                                        \
     adi_pwr_ExitLowPowerMode(&(DEV)->bLowPowerExitFlag)
     
-#define  ISR_PROLOG()
-                
-#define  ISR_EPILOG()
-
 #else
 
 #define PEND_VAR_DECLR       volatile uint8_t nSemCount;
@@ -137,11 +129,45 @@ extern "C" {
     (DEV)->nSemCount++;         \
 }
 
-#define  ISR_PROLOG()
+#endif /* ADI_CFG_ENABLE_RTOS_SUPPORT */
 
-#define  ISR_EPILOG()
+#include <services/trace/adi_trace.h>
+#include <services/stats/adi_stats.h>
 
-#endif /* ADI_CFG_ENABLE_RTOS_SUPPORT */
+/* IF (Event trace is enabled) */
+#if (ADI_CFG_ENABLE_TRACE == 1)
+
+#define  ISR_TRACE_BEGIN()    adi_trace_Isr(ADI_TRACE_ISR_BEGIN)
+
+#define  ISR_TRACE_END()      adi_trace_Isr(ADI_TRACE_ISR_END)
+
+#else
+
+#define  ISR_TRACE_BEGIN()
+
+#define  ISR_TRACE_END()
+
+#endif /* ADI_CFG_ENABLE_TRACE */
+
+/* IF (Driver statistics are enabled) */
+#if (ADI_CFG_ENABLE_STATS == 1)
+
+#define  ISR_STATS_BEGIN()    uint32_t const nIsrStatsStart = adi_stats_IsrBegin()
+
+#define  ISR_STATS_END()      adi_stats_IsrEnd(nIsrStatsStart)
+
+#else
+
+#define  ISR_STATS_BEGIN()
+
+#define  ISR_STATS_END()
+
+#endif /* ADI_CFG_ENABLE_STATS */
+
+/* Every interrupt handler starts with ISR_PROLOG() and ends with ISR_EPILOG() */
+#define  ISR_PROLOG()    ISR_STATS_BEGIN(); ISR_TRACE_BEGIN()
+
+#define  ISR_EPILOG()    ISR_TRACE_END(); ISR_STATS_END()
 
 #ifdef __cplusplus
 }
@@ -183,6 +183,9 @@ extern "C" {
 #define ADI_WEAK_FUNCTION(x)      WEAK_FUNC  ( void x (void)) { while(1) {} }
 #endif
 
+/* Vector table entries: the initial MSP, 15 system exceptions and IRQs 0..63 */
+#define LENGTHOF_IVT  (1u + 15u + 64u)
+
 #ifndef PENDSV_HANDLER
 #define PENDSV_HANDLER  PendSV_Handler
 #endif
@@ -0,0 +1,431 @@
+
+#include <adi_processor.h>
+#include <drivers/uart/adi_uart.h>
+#include <drivers/spi/adi_spi.h>
+#include <services/pwr/adi_pwr.h>
+#include <services/stats/adi_stats.h>
+
+#include "common.h"
+#include "temperature_sensor.h"
+#include "Communications.h"
+#include "isr_benchmark.h"
+
+//also run by the code benchmark of code_bench.c when the statistics are on
+#if (ISR_BENCHMARK_ENABLE == 1) || ((CODE_BENCH_ENABLE == 1) && (ADI_CFG_ENABLE_STATS == 1))
+
+#if (ADI_CFG_ENABLE_STATS != 1)
+#error "The ISR benchmark needs ADI_CFG_ENABLE_STATS set to 1 in adi_global_config.h"
+#endif
+
+#define UART_BUFFERS        3u          //transmit and receive buffers the UART driver queues
+#define UART_CHAIN_SIZE     16u         //bytes per buffer of the chained workloads
+#define BREAK_CHARACTERS    4u          //break length in characters
+#define I2C_MAX_LIST        3u          //longest transaction list
+
+//break count, written by the UART handler
+#define UART_BREAKS()       (*(volatile uint32_t *)&adi_stats_Data.Uart.nBreaks)
+
+typedef unsigned char (*ISR_WORKLOAD_FN)(uint32_t _param);
+
+typedef struct
+{
+  const char      *Name;
+  ISR_WORKLOAD_FN  Run;
+  uint32_t         Param;
+} ISR_WORKLOAD;
+
+static unsigned char UartTransfer(uint32_t _size);
+static unsigned char UartFifo(uint32_t _trigger);
+static unsigned char UartChain(uint32_t _buffers);
+static unsigned char UartBreak(uint32_t _unused);
+static unsigned char SpiTransfer(uint32_t _size);
+static unsigned char SpiDma(uint32_t _size);
+static unsigned char I2cList(uint32_t _count);
+static unsigned char I2cNack(uint32_t _unused);
+static unsigned char GpioGroup(uint32_t _pins);
+static unsigned char GpioExternal(uint32_t _unused);
+
+//the workloads, in report order. Names are the keys of the host side diff.
+//UART DMA support is off in adi_uart_config.h, DMAInterruptHandler runs for the SPI ones.
+static const ISR_WORKLOAD Workloads[] =
+{
+  { "uart_int_1",        UartTransfer,  1u },
+  { "uart_int_16",       UartTransfer,  16u },
+  { "uart_int_64",       UartTransfer,  64u },
+  { "uart_fifo_trig1",   UartFifo,      ADI_UART_RX_FIFO_TRIG_LEVEL_1BYTE },
+  { "uart_fifo_trig4",   UartFifo,      ADI_UART_RX_FIFO_TRIG_LEVEL_4BYTE },
+  { "uart_fifo_trig8",   UartFifo,      ADI_UART_RX_FIFO_TRIG_LEVEL_8BYTE },
+  { "uart_fifo_trig14",  UartFifo,      ADI_UART_RX_FIFO_TRIG_LEVEL_14BYTE },
+  { "uart_chain_1",      UartChain,     1u },
+  { "uart_chain_3",      UartChain,     UART_BUFFERS },
+  { "uart_break",        UartBreak,     0u },
+  { "spi_int_1",         SpiTransfer,   1u },
+  { "spi_int_8",         SpiTransfer,   8u },
+  { "spi_int_64",        SpiTransfer,   64u },
+  { "spi_dma_64",        SpiDma,        64u },
+  { "spi_dma_256",       SpiDma,        256u },
+  { "i2c_list_1",        I2cList,       1u },
+  { "i2c_list_3",        I2cList,       I2C_MAX_LIST },
+  { "i2c_nack",          I2cNack,       0u },
+  { "gpio_group_1pin",   GpioGroup,     ADI_GPIO_PIN_2 },
+  { "gpio_group_2pins",  GpioGroup,     ISR_BENCHMARK_PINS },
+  { "gpio_ext0",         GpioExternal,  0u }
+};
+
+static uint8_t UartMem[ADI_UART_BIDIR_MEMORY_SIZE];
+static uint8_t SpiMem[ADI_SPI_MEMORY_SIZE];
+static ADI_UART_HANDLE hUart;
+static ADI_SPI_HANDLE  hSpi;
+static ADI_I2C_HANDLE  hI2c;
+static uint16_t        I2cAddress;
+static uint8_t         I2cRegister;
+
+static uint8_t TxData[UART_BUFFERS][ISR_BENCHMARK_MAX_BYTES];
+static uint8_t RxData[UART_BUFFERS][ISR_BENCHMARK_MAX_BYTES];
+static ADI_STATS Stats;
+
+static volatile uint32_t Fired;//GPIO callbacks seen by the current trigger
+
+
+/********************************************************************
+* Busy wait, for the break length                                    *
+*********************************************************************/
+static void WaitCycles(uint32_t _cycles)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  while((DWT->CYCCNT - start) < _cycles)
+  {
+  }
+}
+
+
+/********************************************************************
+* Wait for the callback of one GPIO trigger                          *
+*********************************************************************/
+static unsigned char WaitFired(void)
+{
+  uint32_t polls;
+
+  for(polls = 0; polls < ISR_BENCHMARK_TIMEOUT; polls++)
+  {
+    if(Fired != 0)
+      return 0;
+  }
+  return 1;
+}
+
+
+static void GpioCallback(void *pCBParam, uint32_t Event, void *pArg)
+{
+  Fired++;
+}
+
+
+/********************************************************************
+* Send _buffers buffers of _size bytes through the UART loopback     *
+*********************************************************************/
+static unsigned char UartLoop(uint32_t _buffers, uint32_t _size)
+{
+  void *pBuffer;
+  uint32_t i;
+
+  //receive buffers first, the loopback delivers as soon as the first byte is out
+  for(i = 0; i < _buffers; i++)
+  {
+    if(adi_uart_SubmitRxBuffer(hUart, RxData[i], _size) != ADI_UART_SUCCESS)
+      return 1;
+  }
+  for(i = 0; i < _buffers; i++)
+  {
+    if(adi_uart_SubmitTxBuffer(hUart, TxData[i], _size) != ADI_UART_SUCCESS)
+      return 1;
+  }
+  for(i = 0; i < _buffers; i++)
+  {
+    if(adi_uart_GetTxBuffer(hUart, &pBuffer) != ADI_UART_SUCCESS)
+      return 1;
+    if(adi_uart_GetRxBuffer(hUart, &pBuffer) != ADI_UART_SUCCESS)
+      return 1;
+  }
+  return 0;
+}
+
+
+/********************************************************************
+* UART workloads                                                     *
+*********************************************************************/
+static unsigned char UartTransfer(uint32_t _size)
+{
+  if(adi_uart_EnableFifo(hUart, false) != ADI_UART_SUCCESS)
+    return 1;
+  return UartLoop(1u, _size);
+}
+
+static unsigned char UartFifo(uint32_t _trigger)
+{
+  unsigned char result;
+
+  if(adi_uart_EnableFifo(hUart, true) != ADI_UART_SUCCESS)
+    return 1;
+  if(adi_uart_SetRxFifoTriggerLevel(hUart, (ADI_UART_TRIG_LEVEL)_trigger) != ADI_UART_SUCCESS)
+    return 1;
+  result = UartLoop(1u, 64u);
+  adi_uart_EnableFifo(hUart, false);
+  return result;
+}
+
+static unsigned char UartChain(uint32_t _buffers)
+{
+  if(adi_uart_EnableFifo(hUart, false) != ADI_UART_SUCCESS)
+    return 1;
+  return UartLoop(_buffers, UART_CHAIN_SIZE);
+}
+
+static unsigned char UartBreak(uint32_t _unused)
+{
+  uint32_t hclk;
+  uint32_t breaks = UART_BREAKS();
+  uint32_t polls;
+
+  if(adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &hclk) != ADI_PWR_SUCCESS)
+    return 1;
+  if(adi_uart_EnableRxStatusInterrupt(hUart, true) != ADI_UART_SUCCESS)
+    return 1;
+
+  //11 bit times per character at 115200
+  adi_uart_ForceTxBreak(hUart, true);
+  WaitCycles((hclk / 115200u) * 11u * BREAK_CHARACTERS);
+  adi_uart_ForceTxBreak(hUart, false);
+
+  for(polls = 0; (UART_BREAKS() == breaks) && (polls < ISR_BENCHMARK_TIMEOUT); polls++)
+  {
+  }
+  adi_uart_EnableRxStatusInterrupt(hUart, false);
+  return (UART_BREAKS() != breaks) ? 0 : 1;
+}
+
+
+/********************************************************************
+* SPI workloads                                                      *
+*********************************************************************/
+static unsigned char SpiTransfer(uint32_t _size)
+{
+  ADI_SPI_TRANSCEIVER xfr;
+
+  xfr.pTransmitter = TxData[0];
+  xfr.pReceiver = RxData[0];
+  xfr.TransmitterBytes = _size;
+  xfr.ReceiverBytes = _size;
+  xfr.nTxIncrement = true;
+  xfr.nRxIncrement = true;
+  return (adi_spi_ReadWrite(hSpi, &xfr) == ADI_SPI_SUCCESS) ? 0 : 1;
+}
+
+static unsigned char SpiDma(uint32_t _size)
+{
+  unsigned char result;
+
+  if(adi_spi_EnableDmaMode(hSpi, true) != ADI_SPI_SUCCESS)
+    return 1;
+  result = SpiTransfer(_size);
+  adi_spi_EnableDmaMode(hSpi, false);
+  return result;
+}
+
+
+/********************************************************************
+* I2C workloads, register reads from the sensor                      *
+*********************************************************************/
+static unsigned char I2cRun(uint16_t _address, uint32_t _count)
+{
+  ADI_I2C_TRANSACTION list[I2C_MAX_LIST];
+  uint32_t i;
+
+  for(i = 0; i < _count; i++)
+  {
+    list[i].pTxBuffer = &I2cRegister;
+    list[i].pRxBuffer = &RxData[0][i];
+    list[i].nSlaveAddr = _address;
+    list[i].nTxSize = 1u;
+    list[i].nRxSize = 1u;
+    list[i].bRestart = true;
+  }
+  if(adi_i2c_SubmitTransactionList(hI2c, list, _count) != ADI_I2C_SUCCESS)
+    return 1;
+  return (adi_i2c_GetTransactionListResult(hI2c, NULL) == ADI_I2C_SUCCESS) ? 0 : 1;
+}
+
+static unsigned char I2cList(uint32_t _count)
+{
+  return I2cRun(I2cAddress, _count);
+}
+
+static unsigned char I2cNack(uint32_t _unused)
+{
+  //the error path is the workload, the list is expected to fail
+  return (I2cRun(ISR_BENCHMARK_ABSENT_ADDR, 1u) != 0) ? 0 : 1;
+}
+
+
+/********************************************************************
+* GPIO workloads                                                     *
+*********************************************************************/
+static unsigned char GpioGroup(uint32_t _pins)
+{
+  ADI_GPIO_DATA pins = (ADI_GPIO_DATA)_pins;
+  unsigned char lost;
+
+  adi_gpio_SetLow(ISR_BENCHMARK_PORT, pins);
+  adi_gpio_OutputEnable(ISR_BENCHMARK_PORT, pins, true);
+  adi_gpio_InputEnable(ISR_BENCHMARK_PORT, pins, true);
+  adi_gpio_SetGroupInterruptPolarity(ISR_BENCHMARK_PORT, pins);
+  adi_gpio_ClrGroupInterruptStatus(ISR_BENCHMARK_PORT, pins);
+  if(adi_gpio_RegisterCallback(SYS_GPIO_INTA_IRQn, GpioCallback, NULL) != ADI_GPIO_SUCCESS)
+    return 1;
+  adi_gpio_SetGroupInterruptPins(ISR_BENCHMARK_PORT, SYS_GPIO_INTA_IRQn, pins);
+
+  //all the pins rise together, one interrupt
+  Fired = 0;
+  adi_gpio_SetHigh(ISR_BENCHMARK_PORT, pins);
+  lost = WaitFired();
+
+  adi_gpio_SetGroupInterruptPins(ISR_BENCHMARK_PORT, SYS_GPIO_INTA_IRQn, 0);
+  adi_gpio_RegisterCallback(SYS_GPIO_INTA_IRQn, NULL, NULL);
+  adi_gpio_SetLow(ISR_BENCHMARK_PORT, pins);
+  adi_gpio_InputEnable(ISR_BENCHMARK_PORT, pins, false);
+  adi_gpio_OutputEnable(ISR_BENCHMARK_PORT, pins, false);
+  return lost;
+}
+
+static unsigned char GpioExternal(uint32_t _unused)
+{
+  unsigned char lost;
+
+  if(adi_gpio_RegisterCallback(XINT_EVT0_IRQn, GpioCallback, NULL) != ADI_GPIO_SUCCESS)
+    return 1;
+  if(adi_gpio_EnableExIRQ(XINT_EVT0_IRQn, ADI_GPIO_IRQ_RISING_EDGE) != ADI_GPIO_SUCCESS)
+    return 1;
+
+  Fired = 0;
+  NVIC_SetPendingIRQ(XINT_EVT0_IRQn);
+  lost = WaitFired();
+
+  adi_gpio_DisableExIRQ(XINT_EVT0_IRQn);
+  adi_gpio_RegisterCallback(XINT_EVT0_IRQn, NULL, NULL);
+  return lost;
+}
+
+
+/********************************************************************
+* Open UART0 and SPI1 in loopback                                    *
+*********************************************************************/
+static unsigned char OpenLoopbacks(void)
+{
+  if(adi_uart_Open(UART_DEVICE_NUM, ADI_UART_DIR_BIDIRECTION, UartMem, sizeof(UartMem), &hUart) != ADI_UART_SUCCESS)
+    return 1;
+  if(adi_uart_SetConfiguration(hUart, ADI_UART_NO_PARITY, ADI_UART_ONE_AND_HALF_TWO_STOPBITS,
+                               ADI_UART_WORDLEN_8BITS) != ADI_UART_SUCCESS)
+    return 1;
+  if(adi_uart_ConfigBaudRate(hUart, UART_DIV_C_115200, UART_DIV_M_115200, UART_DIV_N_115200,
+                             UART_OSR_115200) != ADI_UART_SUCCESS)
+    return 1;
+  if(adi_uart_EnableLoopBack(hUart, true) != ADI_UART_SUCCESS)
+    return 1;
+
+  if(adi_spi_Open(ISR_BENCHMARK_SPI_DEV, SpiMem, sizeof(SpiMem), &hSpi) != ADI_SPI_SUCCESS)
+    return 1;
+  if(adi_spi_SetBitrate(hSpi, 1000000) != ADI_SPI_SUCCESS)
+    return 1;
+  if(adi_spi_SetChipSelect(hSpi, ADI_SPI_CS_NONE) != ADI_SPI_SUCCESS)
+    return 1;
+  if(adi_spi_SetLoopback(hSpi, true) != ADI_SPI_SUCCESS)
+    return 1;
+  return 0;
+}
+
+
+/********************************************************************
+* Print the handlers that ran during one workload                    *
+*********************************************************************/
+static void Report(const char *_name)
+{
+  ADI_STATS_ISR const *pIsr;
+  uint32_t irq;
+
+  adi_stats_Snapshot(&Stats, false);
+  for(irq = 0; irq < ADI_STATS_NUM_IRQ; irq++)
+  {
+    pIsr = &Stats.Isr[irq];
+    if(pIsr->nCalls == 0u)
+      continue;
+    DEBUG_MESSAGE("isrbench,%s,%u,%u,%u,%u,%u\n", _name, irq, pIsr->nCalls,
+                  pIsr->nMinCycles, pIsr->nCycles / pIsr->nCalls, pIsr->nMaxCycles);
+  }
+}
+
+
+/**********************************************************************************************
+* Function Name: IsrBenchmark_Run
+* Description  : This function runs every workload ISR_BENCHMARK_RUNS times and prints the
+*                interrupt handler cycles of each, see isr_benchmark.h for the format. The
+*                UART and SPI devices used are closed again and the driver counters reset.
+* Arguments    : ADI_I2C_HANDLE _hI2c = open I2C master with the sensor on the bus
+*                uint16_t _address = sensor address
+*                uint8_t _register = sensor register to read
+* Return Value : 0 = Success
+*                1 = Failure, a device could not be opened or a workload failed
+**********************************************************************************************/
+unsigned char IsrBenchmark_Run(ADI_I2C_HANDLE _hI2c, uint16_t _address, uint8_t _register)
+{
+  uint32_t hclk;
+  uint32_t w, i;
+  unsigned char failed = 0;
+
+  hI2c = _hI2c;
+  I2cAddress = _address;
+  I2cRegister = _register;
+
+  if(adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &hclk) != ADI_PWR_SUCCESS)
+    return 1;
+  if(OpenLoopbacks() != 0)
+  {
+    DEBUG_MESSAGE("isrbench,open,failed\n");
+    failed = 1;
+  }
+  else
+  {
+    DEBUG_MESSAGE("isrbench,hclk,%u\n", hclk);
+    DEBUG_MESSAGE("isrbench,workload,irq,calls,min,avg,max\n");
+    for(w = 0; w < (sizeof(Workloads) / sizeof(Workloads[0])); w++)
+    {
+      adi_stats_Snapshot(&Stats, true);
+      for(i = 0; i < ISR_BENCHMARK_RUNS; i++)
+      {
+        if(Workloads[w].Run(Workloads[w].Param) != 0)
+          break;
+      }
+      if(i < ISR_BENCHMARK_RUNS)
+      {
+        DEBUG_MESSAGE("isrbench,%s,failed\n", Workloads[w].Name);
+        failed = 1;
+      }
+      else
+      {
+        Report(Workloads[w].Name);
+      }
+    }
+  }
+
+  if(hUart != NULL)
+  {
+    adi_uart_EnableLoopBack(hUart, false);
+    adi_uart_Close(hUart);
+  }
+  if(hSpi != NULL)
+    adi_spi_Close(hSpi);
+  adi_stats_Snapshot(&Stats, true);
+  return failed;
+}
+
+#endif /* ISR_BENCHMARK_ENABLE */
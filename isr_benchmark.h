@@ -0,0 +1,51 @@
+
+#ifndef _ISR_BENCHMARK_H_
+#define _ISR_BENCHMARK_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include <drivers/i2c/adi_i2c.h>
+#include <services/gpio/adi_gpio.h>
+
+
+/******************************************************************************/
+/* ISR benchmark parameters                                                   */
+/******************************************************************************/
+
+/*
+ * Startup benchmark of the driver interrupt handlers, built with
+ * ISR_BENCHMARK_ENABLE (or CODE_BENCH_ENABLE) of temperature_sensor.h and needs
+ * ADI_CFG_ENABLE_STATS in adi_global_config.h. Each workload runs ISR_BENCHMARK_RUNS times and the
+ * handler cycles counted by ISR_PROLOG/ISR_EPILOG are reported per IRQn, one
+ * line per handler that ran:
+ *
+ *   isrbench,<workload>,<IRQn>,<calls>,<min>,<avg>,<max>
+ *
+ * Cycles are core cycles at the HCLK of the "isrbench,hclk,<Hz>" line. A
+ * workload that fails reports "isrbench,<workload>,failed" instead.
+ * tools/isr_bench_diff.py compares two captures.
+ *
+ * UART0 and SPI1 run in internal loopback, the UART must not be open yet and
+ * the pins see no traffic. The I2C workloads use the sensor, the GPIO ones two
+ * pins with their output and input enabled, which must not be connected.
+ */
+#define ISR_BENCHMARK_RUNS          20                 //repetitions of each workload
+#define ISR_BENCHMARK_SPI_DEV       1                  //SPI device, only used here
+#define ISR_BENCHMARK_ABSENT_ADDR   0x77               //I2C address without a device, for the NACK path
+#define ISR_BENCHMARK_PORT          ADI_GPIO_PORT2     //loopback pins of the GPIO workloads
+#define ISR_BENCHMARK_PINS          (ADI_GPIO_PIN_2 | ADI_GPIO_PIN_3)
+#define ISR_BENCHMARK_TIMEOUT       100000             //polls before a GPIO or break event counts as lost
+#define ISR_BENCHMARK_MAX_BYTES     256                //largest transfer
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//run all the workloads and print the handler timings, GPIO service open
+unsigned char IsrBenchmark_Run(ADI_I2C_HANDLE _hI2c, uint16_t _address, uint8_t _register);
+
+#endif /* _ISR_BENCHMARK_H_ */
@@ -0,0 +1,200 @@
+
+#include <adi_processor.h>
+#include <services/pwr/adi_pwr.h>
+#include <services/latency/adi_latency.h>
+
+#include "common.h"
+#include "temperature_sensor.h"
+#include "latency_test.h"
+
+#if (LATENCY_TEST_ENABLE == 1)
+
+#if (ADI_CFG_ENABLE_LATENCY != 1)
+#error "The latency test needs ADI_CFG_ENABLE_LATENCY set to 1 in adi_global_config.h"
+#endif
+
+#define CYCLES_PER_US(_hclk) ((_hclk) / 1000000u)
+
+static volatile uint32_t Fired;//callbacks seen by the current trigger
+
+static const char * const IrqNames[ADI_LATENCY_NUM_IRQ] =
+{
+  "Ext_Int0", "Ext_Int1", "Ext_Int2", "Ext_Int3", "GPIO_A", "GPIO_B"
+};
+
+
+/********************************************************************
+* Callback of the triggered interrupts                               *
+*********************************************************************/
+static void LatencyCallback(void *pCBParam, uint32_t Event, void *pArg)
+{
+  Fired++;
+}
+
+
+/********************************************************************
+* Wait for the callback of one trigger                               *
+*********************************************************************/
+static unsigned char WaitFired(void)
+{
+  uint32_t polls;
+
+  for(polls = 0; polls < LATENCY_TEST_TIMEOUT; polls++)
+  {
+    if(Fired != 0)
+      return 0;
+  }
+  return 1;
+}
+
+
+/********************************************************************
+* Trigger an external interrupt from software                        *
+*********************************************************************/
+static unsigned char TriggerExternal(uint32_t _irq, IRQn_Type _eIrq)
+{
+  uint32_t i;
+  unsigned char lost = 0;
+
+  if(adi_gpio_RegisterCallback(_eIrq, LatencyCallback, NULL) != ADI_GPIO_SUCCESS)
+    return 1;
+  if(adi_gpio_EnableExIRQ(_eIrq, ADI_GPIO_IRQ_RISING_EDGE) != ADI_GPIO_SUCCESS)
+    return 1;
+
+  for(i = 0; i < LATENCY_TEST_RUNS; i++)
+  {
+    Fired = 0;
+    adi_latency_Arm(_irq);
+    NVIC_SetPendingIRQ(_eIrq);
+    lost |= WaitFired();
+  }
+
+  adi_gpio_DisableExIRQ(_eIrq);
+  adi_gpio_RegisterCallback(_eIrq, NULL, NULL);
+  return lost;
+}
+
+
+/********************************************************************
+* Trigger a group interrupt with rising edges on the loopback pin    *
+*********************************************************************/
+static unsigned char TriggerGroup(uint32_t _irq, IRQn_Type _eIrq)
+{
+  uint32_t i;
+  unsigned char lost = 0;
+
+  adi_gpio_SetLow(LATENCY_TEST_PORT, LATENCY_TEST_PIN);
+  adi_gpio_OutputEnable(LATENCY_TEST_PORT, LATENCY_TEST_PIN, true);
+  adi_gpio_InputEnable(LATENCY_TEST_PORT, LATENCY_TEST_PIN, true);
+  adi_gpio_SetGroupInterruptPolarity(LATENCY_TEST_PORT, LATENCY_TEST_PIN);
+  adi_gpio_ClrGroupInterruptStatus(LATENCY_TEST_PORT, LATENCY_TEST_PIN);
+  if(adi_gpio_RegisterCallback(_eIrq, LatencyCallback, NULL) != ADI_GPIO_SUCCESS)
+    return 1;
+  if(adi_gpio_SetGroupInterruptPins(LATENCY_TEST_PORT, _eIrq, LATENCY_TEST_PIN) != ADI_GPIO_SUCCESS)
+    return 1;
+
+  for(i = 0; i < LATENCY_TEST_RUNS; i++)
+  {
+    Fired = 0;
+    adi_latency_Arm(_irq);
+    adi_gpio_SetHigh(LATENCY_TEST_PORT, LATENCY_TEST_PIN);
+    lost |= WaitFired();
+    adi_gpio_SetLow(LATENCY_TEST_PORT, LATENCY_TEST_PIN);
+  }
+
+  adi_gpio_SetGroupInterruptPins(LATENCY_TEST_PORT, _eIrq, 0);
+  adi_gpio_RegisterCallback(_eIrq, NULL, NULL);
+  adi_gpio_InputEnable(LATENCY_TEST_PORT, LATENCY_TEST_PIN, false);
+  adi_gpio_OutputEnable(LATENCY_TEST_PORT, LATENCY_TEST_PIN, false);
+  return lost;
+}
+
+
+/********************************************************************
+* Report one interrupt and check it against the budgets              *
+*********************************************************************/
+static unsigned char CheckIrq(uint32_t _irq, uint32_t _hclk)
+{
+  ADI_LATENCY_IRQ const *pIrq = &adi_latency_Irq[_irq];
+
+  DEBUG_MESSAGE("%s: entry %u..%u cycles, callback %u..%u cycles, %u/%u runs\n",
+                IrqNames[_irq],
+                pIrq->Entry.nMinCycles, pIrq->Entry.nMaxCycles,
+                pIrq->Callback.nMinCycles, pIrq->Callback.nMaxCycles,
+                pIrq->Callback.nCount, LATENCY_TEST_RUNS);
+
+  if((pIrq->Entry.nCount != LATENCY_TEST_RUNS) || (pIrq->Callback.nCount != LATENCY_TEST_RUNS))
+    return 1;
+  if(pIrq->Entry.nMaxCycles > (LATENCY_BUDGET_ENTRY_US * CYCLES_PER_US(_hclk)))
+    return 1;
+  if(pIrq->Callback.nMaxCycles > (LATENCY_BUDGET_CALLBACK_US * CYCLES_PER_US(_hclk)))
+    return 1;
+  return 0;
+}
+
+
+/********************************************************************
+* Report the critical regions and check them against the budget      *
+*********************************************************************/
+static unsigned char CheckRegions(uint32_t _hclk)
+{
+  ADI_LATENCY_SITE const *pSite;
+  uint32_t const *h;
+  unsigned char failed = 0;
+
+  for(pSite = adi_latency_GetSites(); pSite != NULL; pSite = pSite->pNext)
+  {
+    h = pSite->aHistogram;
+    DEBUG_MESSAGE("%s:%u %u regions, max %u cycles [%u %u %u %u %u %u %u %u]\n",
+                  pSite->pFile, pSite->nLine, pSite->nCount, pSite->nMaxCycles,
+                  h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7]);
+    if(pSite->nMaxCycles > (LATENCY_BUDGET_REGION_US * CYCLES_PER_US(_hclk)))
+      failed = 1;
+  }
+  return failed;
+}
+
+
+/**********************************************************************************************
+* Function Name: LatencyTest_Run
+* Description  : This function triggers each GPIO interrupt LATENCY_TEST_RUNS times, reports
+*                the entry and callback latencies and the critical regions seen so far, and
+*                checks them against the LATENCY_BUDGET_xxx limits. The result is reported
+*                with test_Pass or test_Fail. Interrupts must be enabled.
+* Arguments    : void
+* Return Value : 0 = All the budgets are met
+*                1 = Failure, a trigger was lost or a budget exceeded
+**********************************************************************************************/
+unsigned char LatencyTest_Run(void)
+{
+  uint32_t hclk;
+  uint32_t irq;
+  unsigned char failed = 0;
+
+  if(adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &hclk) != ADI_PWR_SUCCESS)
+  {
+    test_Fail("latency test: no HCLK frequency");
+    return 1;
+  }
+
+  failed |= TriggerExternal(ADI_LATENCY_IRQ_EXT0, XINT_EVT0_IRQn);
+  failed |= TriggerExternal(ADI_LATENCY_IRQ_EXT1, XINT_EVT1_IRQn);
+  failed |= TriggerExternal(ADI_LATENCY_IRQ_EXT2, XINT_EVT2_IRQn);
+  failed |= TriggerExternal(ADI_LATENCY_IRQ_EXT3, XINT_EVT3_IRQn);
+  failed |= TriggerGroup(ADI_LATENCY_IRQ_GROUPA, SYS_GPIO_INTA_IRQn);
+  failed |= TriggerGroup(ADI_LATENCY_IRQ_GROUPB, SYS_GPIO_INTB_IRQn);
+
+  for(irq = ADI_LATENCY_IRQ_EXT0; irq < ADI_LATENCY_NUM_IRQ; irq++)
+    failed |= CheckIrq(irq, hclk);
+  failed |= CheckRegions(hclk);
+
+  if(failed != 0)
+  {
+    test_Fail("latency budget exceeded");
+    return 1;
+  }
+  test_Pass();
+  return 0;
+}
+
+#endif /* LATENCY_TEST_ENABLE */
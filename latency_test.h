@@ -0,0 +1,48 @@
+
+#ifndef _LATENCY_TEST_H_
+#define _LATENCY_TEST_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include <services/gpio/adi_gpio.h>
+
+
+/******************************************************************************/
+/* latency test parameters                                                    */
+/******************************************************************************/
+
+/*
+ * Startup check of the interrupt latency budgets, built with LATENCY_TEST_ENABLE
+ * of temperature_sensor.h and needs ADI_CFG_ENABLE_LATENCY in adi_global_config.h.
+ *
+ * External interrupts 0 to 3 are triggered by pending them in the NVIC, the
+ * GPIO group A and B interrupts by driving a pin that has both its output and
+ * its input enabled, so no wiring is needed. The pin must not be connected to
+ * anything else. Each interrupt is triggered LATENCY_TEST_RUNS times and the
+ * latency measured from the trigger to the handler entry and to the callback.
+ *
+ * The longest critical region of every call site seen since reset is checked
+ * as well, which covers the boot and the test itself.
+ */
+#define LATENCY_TEST_RUNS           100              //triggers per interrupt
+#define LATENCY_TEST_TIMEOUT        10000            //polls before a trigger counts as lost
+#define LATENCY_TEST_PORT           ADI_GPIO_PORT2   //loopback pin of the group interrupts
+#define LATENCY_TEST_PIN            ADI_GPIO_PIN_2
+
+//budgets in microseconds, converted at the current HCLK
+#define LATENCY_BUDGET_ENTRY_US     5                //trigger to handler entry
+#define LATENCY_BUDGET_CALLBACK_US  10               //trigger to callback
+#define LATENCY_BUDGET_REGION_US    50               //longest critical region
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//measure the interrupt latencies and check all the budgets, GPIO service open
+unsigned char LatencyTest_Run(void);
+
+#endif /* _LATENCY_TEST_H_ */
@@ -0,0 +1,22 @@
+
+/*
+ * Deferred log message table, see deferred_log.h.
+ *
+ * One LOG_MESSAGE(id, format) per message. The position in this file is the
+ * log ID sent by the device, the format string is never compiled into the
+ * image: tools/dlog_decode.py reads this file to rebuild the text. Only add
+ * messages at the end so captures from older builds still decode.
+ *
+ * Formats take up to DLOG_MAX_ARGS 32 bit arguments and the conversions of
+ * test_VFormat(): %d %i %u %x %X %c %% with '0', width, and %.Nk fixed point.
+ * There is no %s, only the raw argument words are logged.
+ *
+ * No include guard, this file is included once per expansion of LOG_MESSAGE.
+ */
+
+LOG_MESSAGE(LOG_DROPPED,            "log: %u records dropped")
+LOG_MESSAGE(LOG_TEMPERATURE,        "Temperature: %5.1k deg C, %5.1k deg F")
+LOG_MESSAGE(LOG_TRANSPORT_FULL,     "transport: window full, %u frames in flight")
+LOG_MESSAGE(LOG_SAMPLER_OVERRUNS,   "sampler: %u periods skipped")
+LOG_MESSAGE(LOG_CLOCK_RESIDENCY,    "clock: %u ms low, %u ms mid, %u ms high")
+LOG_MESSAGE(LOG_IDLE_RESIDENCY,     "idle: %u ms active, %u ms flexi, %u ms hibernate")
@@ -0,0 +1,255 @@
+
+#include <string.h>
+#include <stdarg.h>
+#include <adi_processor.h>
+
+#include "common.h"
+#include "packetizer.h"
+#include "Communications.h"
+#include "clock_governor.h"
+#include "idle_manager.h"
+
+#define PAYLOAD_SIZE            (PKT_ATT_MTU - PKT_ATT_HEADER)//bytes per frame
+#define FRAME_HEADER_SIZE       3u          //SYNC, ID, LENGTH of a text frame
+
+static uint8_t         *Frame = NULL;//UART message block being filled, NULL when empty
+static uint16_t         Fill;//bytes in the frame
+static uint32_t         FirstAt;//ClockGov_Cycles of the oldest byte in the frame
+static uint32_t         MaxAgeCycles;//age limit in root clock cycles, 0 = none
+static PACKETIZER_STATS Stats;//packetizer counters
+
+
+/********************************************************************
+* Write the frame to the UART and start a new one                    *
+*********************************************************************/
+static unsigned char EmitFrame(void)
+{
+  unsigned char result;
+
+  if(Fill == 0u)
+    return 0;
+
+  //the block goes to the UART as it is, the next write takes a new one
+  result = Uart_SendMessage(Frame, Fill);
+  Frame = NULL;
+  Stats.Frames++;
+  if(Fill == PAYLOAD_SIZE)
+    Stats.FullFrames++;
+  Fill = 0u;
+
+  return result;
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_Init
+* Description  : This function empties the frame
+* Arguments    : uint32_t _maxAgeMs = oldest byte a partial frame may hold before Packetizer_Poll
+*                writes it, 0 = partial frames only go out on Packetizer_Flush
+* Return Value : 0 = Success
+*                1 = Failure (age limit longer than the timebase wraps)
+**********************************************************************************************/
+unsigned char Packetizer_Init(uint32_t _maxAgeMs)
+{
+  //the timebase keeps its rate across the clock governor levels
+  if(_maxAgeMs > (0xFFFFFFFFu / (CLOCK_GOV_ROOT_HZ / 1000u)))
+    return 1;
+  MaxAgeCycles = (CLOCK_GOV_ROOT_HZ / 1000u) * _maxAgeMs;
+
+  Uart_FreeMessage(Frame);
+  Frame = NULL;
+  Fill = 0u;
+  memset(&Stats, 0, sizeof(Stats));
+
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_GetPayloadSize
+* Description  : This function returns the number of bytes in a full frame
+* Arguments    : void
+* Return Value : PKT_ATT_MTU - 3
+**********************************************************************************************/
+uint16_t Packetizer_GetPayloadSize(void)
+{
+  return PAYLOAD_SIZE;
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_Write
+* Description  : This function appends a record to the frame. Records can span frames and
+*                every frame the record fills is queued on the UART before the function
+*                returns. Frames are built in UART message blocks and sent without copying.
+*                Every block the record needs is taken first, waiting up to UART_MSG_WAIT_MS
+*                for each, so a record is either written whole or not at all and the caller
+*                can send it again.
+* Arguments    : uint8_t const* _data = record bytes
+*                uint16_t _length = number of bytes, at most PKT_MAX_RECORD
+* Return Value : 0 = Success
+*                1 = Failure (record too long, no free block, or see eUartResult in debug mode
+*                    for adi micro specific info)
+**********************************************************************************************/
+unsigned char Packetizer_Write(uint8_t const * _data, uint16_t _length)
+{
+  uint8_t *blocks[PKT_RECORD_BLOCKS];
+  uint32_t count;
+  uint32_t i;
+  uint16_t chunk;
+  unsigned char result = 0;
+
+  if(_length > PKT_MAX_RECORD)
+    return 1;
+
+  //blocks of the frames the record starts, the partial frame already has one
+  count = ((uint32_t)Fill + _length + PAYLOAD_SIZE - 1u) / PAYLOAD_SIZE;
+  if(Fill != 0u)
+    count--;
+  for(i = 0; i < count; i++)
+  {
+    //wait a bounded time while every block is being sent
+    blocks[i] = (uint8_t *)Uart_AllocMessage(UART_MSG_WAIT_MS);
+    if(blocks[i] == NULL)
+    {
+      while(i > 0u)
+        Uart_FreeMessage(blocks[--i]);
+      return 1;
+    }
+  }
+
+  Stats.Bytes += _length;
+
+  i = 0;
+  while(_length > 0u)
+  {
+    if(Fill == 0u)
+    {
+      Frame = blocks[i++];
+      FirstAt = ClockGov_Cycles();
+    }
+
+    chunk = PAYLOAD_SIZE - Fill;
+    if(chunk > _length)
+      chunk = _length;
+
+    memcpy(&Frame[Fill], _data, chunk);
+    Fill += chunk;
+    _data += chunk;
+    _length -= chunk;
+
+    //only a driver error cuts the record, the blocks taken are still used up
+    if(Fill == PAYLOAD_SIZE)
+    {
+      if(EmitFrame() != 0)
+        result = 1;
+    }
+  }
+
+  return result;
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_Printf
+* Description  : This function formats a TEXT frame straight into a UART message block and
+*                sends the block without copying it. The partial frame goes out first so the
+*                text follows the records written before it. Waits up to UART_MSG_WAIT_MS for
+*                a block. Messages longer than PKT_TEXT_MAX characters are cut.
+* Arguments    : char const* _format = format, see test_VFormat
+*                ... = format arguments
+* Return Value : 0 = Success
+*                1 = Failure (no free block, or see eUartResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Packetizer_Printf(char const * _format, ...)
+{
+  va_list args;
+  uint8_t *pBlock;
+  int32_t length;
+
+  if(EmitFrame() != 0)
+    return 1;
+
+  pBlock = (uint8_t *)Uart_AllocMessage(UART_MSG_WAIT_MS);
+  if(pBlock == NULL)
+    return 1;
+
+  va_start(args, _format);
+  length = test_VFormat((char_t *)&pBlock[FRAME_HEADER_SIZE], PKT_TEXT_MAX + 1u, _format, args);
+  va_end(args);
+
+  if(length <= 0)
+  {
+    Uart_FreeMessage(pBlock);
+    return (length == 0) ? 0 : 1;
+  }
+  if(length > PKT_TEXT_MAX)
+    length = PKT_TEXT_MAX;
+
+  pBlock[0] = CMD_FRAME_SYNC;
+  pBlock[1] = PKT_TEXT_FRAME_ID;
+  pBlock[2] = (uint8_t)length;
+  return Uart_SendMessage(pBlock, (uint16_t)(FRAME_HEADER_SIZE + length));
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_Flush
+* Description  : This function writes the partial frame, if any, without waiting for it to fill
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Packetizer_Flush(void)
+{
+  return EmitFrame();
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_Poll
+* Description  : This function writes the partial frame once its oldest byte is older than the
+*                age limit given to Packetizer_Init. Call it regularly from the main loop.
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Packetizer_Poll(void)
+{
+  if((MaxAgeCycles == 0u) || (Fill == 0u))
+    return 0;
+
+  if((ClockGov_Cycles() - FirstAt) < MaxAgeCycles)
+    return 0;
+
+  Stats.AgeFlushes++;
+  return EmitFrame();
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_NextFlush
+* Description  : This function returns the time until Packetizer_Poll writes the partial frame
+*                for its age, to bound a low power wait
+* Arguments    : void
+* Return Value : time in ms, IDLE_FOREVER without a partial frame or an age limit
+**********************************************************************************************/
+uint32_t Packetizer_NextFlush(void)
+{
+  if((MaxAgeCycles == 0u) || (Fill == 0u))
+    return IDLE_FOREVER;
+
+  return ClockGov_MsUntil(FirstAt + MaxAgeCycles);
+}
+
+
+/**********************************************************************************************
+* Function Name: Packetizer_GetStats
+* Description  : This function returns the packetizer counters since Packetizer_Init
+* Arguments    : void
+* Return Value : packetizer counters
+**********************************************************************************************/
+PACKETIZER_STATS const* Packetizer_GetStats(void)
+{
+  return &Stats;
+}
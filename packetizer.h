@@ -0,0 +1,97 @@
+
+#ifndef _PACKETIZER_H_
+#define _PACKETIZER_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include "Communications.h"
+
+
+/******************************************************************************/
+/* packetizer parameters                                                      */
+/******************************************************************************/
+
+/*
+ * The SPS firmware of the BLE module forwards the UART byte stream in ATT
+ * notifications of at most ATT_MTU - 3 bytes. Records written here are
+ * coalesced into writes of exactly that size so each notification leaves
+ * full. A partial frame goes out when it gets older than the configured age
+ * or on Packetizer_Flush.
+ *
+ * The SPS firmware negotiates the ATT_MTU itself and does not report it over
+ * the UART, PKT_ATT_MTU must match the MTU of its build.
+ */
+#define PKT_ATT_HEADER          3        //ATT opcode and handle of a notification
+#define PKT_ATT_MTU             23       //ATT_MTU of the SPS firmware, 23 without an MTU exchange, at most 247
+#define PKT_DEFAULT_AGE_MS      100      //oldest byte a partial frame may hold, 0 = flush on size and explicitly only
+#define PKT_MAX_RECORD          40       //longest record, the driver stats counter frames take 37 bytes
+
+/*
+ * Packetizer_Printf formats a text frame (command_parser.h framing) straight
+ * into a message block and sends that block as it is, after the partial frame
+ * so the stream keeps its order:
+ *
+ *   TEXT frame payload = up to PKT_TEXT_MAX characters, no terminator
+ *
+ * tools/dlog_decode.py prints them along with the log records.
+ */
+#define PKT_TEXT_FRAME_ID       0x16     //device to host
+#define PKT_TEXT_MAX            32       //characters per message, longer ones are cut
+
+//bytes per UART message block: a frame, or a text frame with the terminator of the formatter
+#define PKT_TEXT_BLOCK_SIZE     (3 + PKT_TEXT_MAX + 1)
+#define PKT_BLOCK_SIZE          (((PKT_ATT_MTU - PKT_ATT_HEADER) > PKT_TEXT_BLOCK_SIZE) ? (PKT_ATT_MTU - PKT_ATT_HEADER) : PKT_TEXT_BLOCK_SIZE)
+
+//message blocks a record can need on top of the partial frame
+#define PKT_RECORD_BLOCKS       ((PKT_MAX_RECORD + (PKT_ATT_MTU - PKT_ATT_HEADER) - 1) / (PKT_ATT_MTU - PKT_ATT_HEADER))
+
+
+#if ((PKT_RECORD_BLOCKS + 1) > UART_MSG_BLOCKS)
+#error "UART_MSG_BLOCKS cannot hold a PKT_MAX_RECORD record and the partial frame"
+#endif
+
+/******************************************************************************/
+/* Types                                                                      */
+/******************************************************************************/
+
+typedef struct
+{
+  uint32_t Frames;                    //frames written to the UART
+  uint32_t FullFrames;                //frames that filled the payload
+  uint32_t AgeFlushes;                //partial frames sent because of their age
+  uint32_t Bytes;                     //record bytes written
+} PACKETIZER_STATS;
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//empty the frame, _maxAgeMs age limit (0 = none)
+unsigned char Packetizer_Init(uint32_t _maxAgeMs);
+
+//current frame payload size
+uint16_t Packetizer_GetPayloadSize(void);
+
+//append a whole record or nothing, full frames are written straight away
+unsigned char Packetizer_Write(uint8_t const * _data, uint16_t _length);
+
+//send a formatted text frame, see test_VFormat, main loop only
+unsigned char Packetizer_Printf(char const * _format, ...);
+
+//write the partial frame now
+unsigned char Packetizer_Flush(void);
+
+//write the partial frame once it is older than the age limit
+unsigned char Packetizer_Poll(void);
+
+//ms until the age flush, IDLE_FOREVER if none
+uint32_t Packetizer_NextFlush(void);
+
+//packetizer counters
+PACKETIZER_STATS const* Packetizer_GetStats(void);
+
+#endif /* _PACKETIZER_H_ */
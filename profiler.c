@@ -0,0 +1,391 @@
+
+#include <stddef.h>
+#include <string.h>
+#include <adi_processor.h>
+#include <services/tmr/adi_tmr.h>
+#include <startup.h>
+
+#include "profiler.h"
+#include "packetizer.h"
+#include "clock_governor.h"
+#include "idle_manager.h"
+
+#define FRAME_HEADER_SIZE   3u          //SYNC, ID, LENGTH
+#define REQUEST_PENDING     0x8000u     //set in Request until Profiler_Poll takes it
+#define FRAME_PC            6u          //stacked PC, after R0-R3, R12 and LR
+#define VECTOR_COUNT        LENGTHOF_IVT//initial MSP, 15 system exceptions and IRQs 0-63, see startup.h
+#define VECTOR_ALIGN        512u        //VTOR alignment, the table size rounded up to a power of two
+#define VECTOR_IRQ_BASE     16u         //vector of interrupt 0
+
+//report progress, one frame per step
+#define REPORT_IDLE         0u
+#define REPORT_INFO         1u
+#define REPORT_DATA         2u
+#define REPORT_END          3u
+
+ADI_TMR_RESULT           eProfilerTmrResult;//timer error variable
+static uint8_t           TimerMem[ADI_TMR_MEMORY_SIZE];//timer memory size
+static ADI_TMR_HANDLE    hTimer;//timer handle, NULL when stopped
+static uint32_t          RateHz;//sampling rate
+
+static uint16_t          Histogram[PROFILER_BUCKETS];//samples per code bucket
+static volatile uint32_t Samples;//all samples
+static volatile uint32_t Outside;//samples outside the histogram range
+static volatile uint32_t SampledPc;//interrupted PC of the current timer interrupt
+
+static void            (*TimerHandler)(void);//driver handler of the timer vector, NULL when not hooked
+static uint32_t          SavedVtor;//vector table in use before HookVector
+#if defined(__ICCARM__)
+#pragma data_alignment=VECTOR_ALIGN
+static uint32_t          Vectors[VECTOR_COUNT];//copy of the vector table with the timer vector hooked
+#else
+static uint32_t          Vectors[VECTOR_COUNT] __attribute__((aligned(VECTOR_ALIGN)));//copy of the vector table with the timer vector hooked
+#endif
+
+static volatile uint16_t Request;//pending request, REQUEST_PENDING | flags
+static uint8_t           ReportState = REPORT_IDLE;//frame sent next
+static uint8_t           ReportFlags;//flags of the report in progress
+static uint32_t          ReportBucket;//next bucket to send
+
+
+void Profiler_TimerSample(uint32_t const *_frame);//external, branched to from the asm below
+
+/********************************************************************
+* Timer interrupt entry. Nothing is pushed yet, bit 2 of the         *
+* EXC_RETURN in LR tells which stack holds the exception frame       *
+*********************************************************************/
+#if defined(__ICCARM__)
+__stackless void Profiler_TimerEntry(void)
+#else
+__attribute__((naked)) void Profiler_TimerEntry(void)
+#endif
+{
+  __asm("tst   lr, #4               \n"
+        "ite   eq                   \n"
+        "mrseq r0, msp              \n"
+        "mrsne r0, psp              \n"
+        "b     Profiler_TimerSample");
+}
+
+
+/********************************************************************
+* Keep the interrupted PC and run the driver's timer handler, only   *
+* reached from Profiler_TimerEntry with LR still holding EXC_RETURN  *
+*********************************************************************/
+void Profiler_TimerSample(uint32_t const *_frame)
+{
+  SampledPc = _frame[FRAME_PC];
+  TimerHandler();
+}
+
+
+/********************************************************************
+* Route the timer interrupt through Profiler_TimerEntry              *
+*********************************************************************/
+static void HookVector(void)
+{
+  static const IRQn_Type Irqs[] = {TMR0_EVT_IRQn, TMR1_EVT_IRQn, TMR2_EVT_IRQn};
+  uint32_t const *table = (uint32_t const *)SCB->VTOR;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t vector = VECTOR_IRQ_BASE + (uint32_t)Irqs[PROFILER_TIMER_DEVICE];
+  uint32_t i;
+
+  __disable_irq();
+  for(i = 0; i < VECTOR_COUNT; i++)
+    Vectors[i] = table[i];
+  TimerHandler = (void (*)(void))table[vector];
+  Vectors[vector] = (uint32_t)Profiler_TimerEntry;
+  SavedVtor = SCB->VTOR;
+  __DSB();
+  SCB->VTOR = (uint32_t)Vectors;
+  __DSB();
+  __ISB();
+  __set_PRIMASK(primask);
+}
+
+static void UnhookVector(void)
+{
+  uint32_t primask;
+
+  if(TimerHandler == NULL)
+    return;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  SCB->VTOR = SavedVtor;
+  __DSB();
+  __ISB();
+  TimerHandler = NULL;
+  __set_PRIMASK(primask);
+}
+
+
+/********************************************************************
+* Timer Interrupt callback, take one sample                          *
+*********************************************************************/
+static void ProfilerTimerCallback(void *pCBParam, uint32_t Event, void *pArg)
+{
+  uint32_t bucket;
+
+  if(Event != (uint32_t)ADI_TMR_EVENT_TIMEOUT)
+    return;
+
+  Samples++;
+  bucket = (SampledPc - PROFILER_CODE_BASE) >> PROFILER_BUCKET_SHIFT;
+  if(bucket >= PROFILER_BUCKETS)
+  {
+    Outside++;
+    return;
+  }
+  if(Histogram[bucket] != 0xFFFFu)
+    Histogram[bucket]++;
+}
+
+
+/********************************************************************
+* Send one INFO, DATA or END frame                                   *
+*********************************************************************/
+static unsigned char SendFrame(uint8_t const *_payload, uint8_t _length)
+{
+  uint8_t frame[FRAME_HEADER_SIZE + 1u + (4u * PROFILER_PAIRS_PER_FRAME)];
+
+  frame[0] = CMD_FRAME_SYNC;
+  frame[1] = PROFILER_FRAME_ID;
+  frame[2] = _length;
+  memcpy(&frame[FRAME_HEADER_SIZE], _payload, _length);
+  return Packetizer_Write(frame, (uint16_t)(FRAME_HEADER_SIZE + _length));
+}
+
+static uint8_t *Put16(uint8_t *_p, uint32_t _value)
+{
+  *_p++ = (uint8_t)(_value >> 8);
+  *_p++ = (uint8_t)_value;
+  return _p;
+}
+
+static uint8_t *Put32(uint8_t *_p, uint32_t _value)
+{
+  _p = Put16(_p, _value >> 16);
+  return Put16(_p, _value);
+}
+
+
+/********************************************************************
+* Send the DATA frame of the next non-empty buckets                  *
+*********************************************************************/
+static unsigned char SendData(void)
+{
+  uint8_t payload[1u + (4u * PROFILER_PAIRS_PER_FRAME)];
+  uint8_t *p = &payload[1];
+  uint32_t bucket = ReportBucket;
+  uint32_t pairs = 0;
+  uint32_t primask;
+
+  payload[0] = PROFILER_SECTION_DATA;
+  for(; (bucket < PROFILER_BUCKETS) && (pairs < PROFILER_PAIRS_PER_FRAME); bucket++)
+  {
+    if(Histogram[bucket] == 0u)
+      continue;
+    p = Put16(p, bucket);
+    p = Put16(p, Histogram[bucket]);
+    pairs++;
+  }
+  if(pairs == 0u)
+  {
+    ReportBucket = PROFILER_BUCKETS;
+    return 0;
+  }
+  if(SendFrame(payload, (uint8_t)(p - payload)) != 0)
+    return 1;
+
+  //clear what was sent, a sample taken since then is lost
+  if((ReportFlags & PROFILER_FLAG_RESET) != 0u)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for(; ReportBucket < bucket; ReportBucket++)
+      Histogram[ReportBucket] = 0u;
+    __set_PRIMASK(primask);
+  }
+  ReportBucket = bucket;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Profiler_Start
+* Description  : This function starts sampling the program counter _rateHz times per second
+*                with GP timer PROFILER_TIMER_DEVICE. The histogram is not cleared.
+* Arguments    : uint32_t _rateHz = sampling rate (at least 2Hz, HFOSC keeps it across clock changes)
+* Return Value : 0 = Success
+*                1 = Failure (See eProfilerTmrResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Profiler_Start(uint32_t _rateHz)
+{
+  static const uint16_t   Dividers[] = {16u, 64u, 256u};
+  static const ADI_TMR_PRESCALER Prescalers[] = {ADI_GPT_PRESCALER_16, ADI_GPT_PRESCALER_64, ADI_GPT_PRESCALER_256};
+  uint32_t ticks = 0;
+  uint32_t i;
+
+  if((hTimer != NULL) || (_rateHz == 0u))
+    return 1;
+
+  //smallest prescaler that fits the period in the 16 bit counter
+  for(i = 0; i < (sizeof(Dividers) / sizeof(Dividers[0])); i++)
+  {
+    ticks = (CLOCK_GOV_ROOT_HZ / Dividers[i]) / _rateHz;
+    if(ticks <= 0xFFFFu)
+      break;
+  }
+  if((ticks == 0u) || (ticks > 0xFFFFu))
+    return 1;
+
+  eProfilerTmrResult = adi_tmr_Open(PROFILER_TIMER_DEVICE, TimerMem, sizeof(TimerMem), &hTimer);
+  if(eProfilerTmrResult != ADI_TMR_SUCCESS)
+  {
+    hTimer = NULL;
+    return 1;
+  }
+
+  eProfilerTmrResult = adi_tmr_SetClockSource(hTimer, ADI_TMR_CLOCK_HFOSC);
+  if(eProfilerTmrResult == ADI_TMR_SUCCESS)
+    eProfilerTmrResult = adi_tmr_SetPrescaler(hTimer, Prescalers[i]);
+  if(eProfilerTmrResult == ADI_TMR_SUCCESS)
+    eProfilerTmrResult = adi_tmr_SetCountMode(hTimer, ADI_TMR_COUNT_DOWN);
+  if(eProfilerTmrResult == ADI_TMR_SUCCESS)
+    eProfilerTmrResult = adi_tmr_SetRunMode(hTimer, ADI_TMR_PERIODIC_MODE);
+  if(eProfilerTmrResult == ADI_TMR_SUCCESS)
+    eProfilerTmrResult = adi_tmr_SetLoadValue(hTimer, (uint16_t)ticks);
+  if(eProfilerTmrResult == ADI_TMR_SUCCESS)
+    eProfilerTmrResult = adi_tmr_RegisterCallback(hTimer, ProfilerTimerCallback, NULL);
+  if(eProfilerTmrResult == ADI_TMR_SUCCESS)
+  {
+    HookVector();
+    eProfilerTmrResult = adi_tmr_Enable(hTimer, true);
+  }
+  if(eProfilerTmrResult != ADI_TMR_SUCCESS)
+  {
+    UnhookVector();
+    adi_tmr_Close(hTimer);
+    hTimer = NULL;
+    return 1;
+  }
+
+  //the timer stops in hibernate
+  Idle_Hold(IDLE_MODE_FLEXI);
+  RateHz = _rateHz;
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Profiler_Stop
+* Description  : This function stops sampling and closes the timer, the histogram is kept for
+*                the next report
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (See eProfilerTmrResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Profiler_Stop(void)
+{
+  if(hTimer == NULL)
+    return 0;
+
+  eProfilerTmrResult = adi_tmr_Enable(hTimer, false);
+  if(eProfilerTmrResult != ADI_TMR_SUCCESS)
+    return 1;
+
+  eProfilerTmrResult = adi_tmr_Close(hTimer);
+  if(eProfilerTmrResult != ADI_TMR_SUCCESS)
+    return 1;
+
+  UnhookVector();
+  hTimer = NULL;
+  Idle_Release(IDLE_MODE_FLEXI);
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Profiler_OnRequest
+* Description  : Command handler for PROFILER_REQUEST_ID frames, see PROFILER_REQUEST_ENTRY.
+*                Only records the request, the report is sent by Profiler_Poll.
+* Arguments    : uint8_t const* _payload = flags
+*                uint8_t _length = 1
+* Return Value : void
+**********************************************************************************************/
+void Profiler_OnRequest(uint8_t const * _payload, uint8_t _length)
+{
+  Request = (uint16_t)(REQUEST_PENDING | _payload[0]);
+}
+
+
+/**********************************************************************************************
+* Function Name: Profiler_Poll
+* Description  : This function sends up to PROFILER_FRAMES_PER_POLL frames of the report in
+*                progress, or starts the report of a pending request. A frame the packetizer
+*                does not take is sent again on the next call. The histogram is cleared as it
+*                is sent if the request asks for it.
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure, the report continues on the next call
+**********************************************************************************************/
+unsigned char Profiler_Poll(void)
+{
+  uint8_t payload[1u + (4u * PROFILER_PAIRS_PER_FRAME)];
+  uint8_t *p;
+  uint16_t request;
+  uint32_t frames;
+
+  if(ReportState == REPORT_IDLE)
+  {
+    request = Request;
+    if((request & REQUEST_PENDING) == 0u)
+      return 0;
+    Request = 0u;
+    ReportFlags = (uint8_t)request;
+    ReportBucket = 0;
+    ReportState = REPORT_INFO;
+  }
+
+  for(frames = 0; (frames < PROFILER_FRAMES_PER_POLL) && (ReportState != REPORT_IDLE); frames++)
+  {
+    switch(ReportState)
+    {
+    case REPORT_INFO:
+      p = payload;
+      *p++ = PROFILER_SECTION_INFO;
+      p = Put32(p, PROFILER_CODE_BASE);
+      *p++ = PROFILER_BUCKET_SHIFT;
+      p = Put16(p, PROFILER_BUCKETS);
+      p = Put16(p, RateHz);
+      if(SendFrame(payload, (uint8_t)(p - payload)) != 0)
+        return 1;
+      ReportState = REPORT_DATA;
+      break;
+
+    case REPORT_DATA:
+      if(SendData() != 0)
+        return 1;
+      if(ReportBucket >= PROFILER_BUCKETS)
+        ReportState = REPORT_END;
+      break;
+
+    default:
+      p = payload;
+      *p++ = PROFILER_SECTION_END;
+      p = Put32(p, Samples);
+      p = Put32(p, Outside);
+      if(SendFrame(payload, (uint8_t)(p - payload)) != 0)
+        return 1;
+      if((ReportFlags & PROFILER_FLAG_RESET) != 0u)
+      {
+        Samples = 0;
+        Outside = 0;
+      }
+      ReportState = REPORT_IDLE;
+      return Packetizer_Flush();
+    }
+  }
+  return 0;
+}
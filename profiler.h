@@ -0,0 +1,89 @@
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include "command_parser.h"
+
+
+/******************************************************************************/
+/* profiler parameters                                                        */
+/******************************************************************************/
+
+/*
+ * Statistical profiler. GP timer PROFILER_TIMER_DEVICE interrupts at the
+ * sampling rate and its callback counts the interrupted program counter in a
+ * histogram of PROFILER_BUCKETS buckets of 1 << PROFILER_BUCKET_SHIFT bytes
+ * from PROFILER_CODE_BASE. Samples outside that range are only counted.
+ * Counts saturate at 0xFFFF. Interrupt handlers of the same or a higher
+ * priority than the timer are only seen once they have returned.
+ *
+ * The PC is read from the exception frame the timer interrupt stacked. While
+ * sampling, VTOR points at a RAM copy of the vector table whose timer vector
+ * enters a naked stub. The stub picks MSP or PSP from the EXC_RETURN in LR
+ * before anything else is pushed, then runs the driver's handler.
+ * Profiler_Stop restores the previous table.
+ *
+ * Host to device:
+ *   REQUEST payload = flags
+ *
+ * Device to host, then an END frame:
+ *   INFO    payload = PROFILER_SECTION_INFO, code base (4 bytes), bucket shift,
+ *                     bucket count (2 bytes), sampling rate in Hz (2 bytes)
+ *   DATA    payload = PROFILER_SECTION_DATA, up to PROFILER_PAIRS_PER_FRAME
+ *                     bucket index (2 bytes), count (2 bytes) pairs
+ *   END     payload = PROFILER_SECTION_END, samples (4 bytes), samples
+ *                     outside the code range (4 bytes)
+ *
+ * All fields MSB first, empty buckets are not sent. The request is only
+ * recorded by the command handler, Profiler_Poll sends the report from the
+ * main loop, PROFILER_FRAMES_PER_POLL frames per call.
+ * tools/profile_symbolize.py requests a report and maps it to functions.
+ */
+#define PROFILER_REQUEST_ID       9            //host to device, index in the command table
+#define PROFILER_FRAME_ID         0x14         //device to host
+
+#define PROFILER_TIMER_DEVICE     1            //GP timer, the sensor sampler uses timer 0
+#define PROFILER_RATE_HZ          1000         //default sampling rate
+#define PROFILER_CODE_BASE        0x00000000u  //start of the profiled flash
+#define PROFILER_BUCKET_SHIFT     5            //32 byte buckets
+#define PROFILER_BUCKETS          2048         //64KB of code, 4KB of RAM
+#define PROFILER_PAIRS_PER_FRAME  6
+#define PROFILER_FRAMES_PER_POLL  8
+
+#define PROFILER_FLAG_RESET       0x01         //clear the histogram after the report
+
+//report sections
+#define PROFILER_SECTION_INFO     0
+#define PROFILER_SECTION_DATA     1
+#define PROFILER_SECTION_END      0xFF
+
+#if ((PROFILER_REQUEST_ID) >= (CMD_TABLE_SIZE))
+#error "PROFILER_REQUEST_ID must be a valid command table index"
+#endif
+
+//command table entry for the REQUEST frame
+#define PROFILER_REQUEST_ENTRY    { Profiler_OnRequest, 1, 1 }
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//start sampling at _rateHz, the histogram is kept
+unsigned char Profiler_Start(uint32_t _rateHz);
+
+//stop sampling and release the timer
+unsigned char Profiler_Stop(void);
+
+//REQUEST frame handler, called by the command parser
+void Profiler_OnRequest(uint8_t const * _payload, uint8_t _length);
+
+//send the pending report, main loop only
+unsigned char Profiler_Poll(void);
+
+#endif /* _PROFILER_H_ */
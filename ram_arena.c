@@ -0,0 +1,84 @@
+
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+#include "ram_arena.h"
+
+static uint32_t Arena[ARENA_SIZE / 4u];//shared buffer memory, word aligned
+static uint32_t Used;//bytes allocated in the current phase
+static uint32_t Peak;//largest Used of any phase
+static uint8_t  Phase = ARENA_PHASE_BOOT;//current phase
+
+
+/**********************************************************************************************
+* Function Name: Arena_Alloc
+* Description  : This function allocates a buffer that stays valid until the end of the
+*                current phase. Main loop and initialization only.
+* Arguments    : uint8_t _phase = phase the caller expects to be in, ARENA_PHASE_xxx
+*                uint32_t _size = size in bytes, rounded up to whole words
+* Return Value : buffer, NULL if the arena is full
+**********************************************************************************************/
+void *Arena_Alloc(uint8_t _phase, uint32_t _size)
+{
+  void *pBuffer;
+
+  //a buffer asked for in the wrong phase would be released under its user
+  assert(_phase == Phase);
+
+  _size = (_size + 3u) & ~3u;
+  if(_size > (ARENA_SIZE - Used))
+  {
+    assert(0);//ARENA_SIZE too small
+    return NULL;
+  }
+
+  pBuffer = &Arena[Used / 4u];
+  Used += _size;
+  if(Used > Peak)
+    Peak = Used;
+  return pBuffer;
+}
+
+
+/**********************************************************************************************
+* Function Name: Arena_Enter
+* Description  : This function ends the current phase, its buffers must no longer be used
+* Arguments    : uint8_t _phase = next phase, after the current one
+* Return Value : void
+**********************************************************************************************/
+void Arena_Enter(uint8_t _phase)
+{
+  assert(_phase > Phase);
+
+#ifndef NDEBUG
+  memset(Arena, ARENA_POISON, Used);
+#endif
+  Used = 0;
+  Phase = _phase;
+}
+
+
+/**********************************************************************************************
+* Function Name: Arena_Phase
+* Description  : This function returns the current phase, see ARENA_CHECK
+* Arguments    : void
+* Return Value : ARENA_PHASE_xxx
+**********************************************************************************************/
+uint8_t Arena_Phase(void)
+{
+  return Phase;
+}
+
+
+/**********************************************************************************************
+* Function Name: Arena_Peak
+* Description  : This function returns the largest allocation total of any phase so far, the
+*                smallest ARENA_SIZE that would have been enough
+* Arguments    : void
+* Return Value : bytes
+**********************************************************************************************/
+uint32_t Arena_Peak(void)
+{
+  return Peak;
+}
@@ -0,0 +1,60 @@
+
+#ifndef _RAM_ARENA_H_
+#define _RAM_ARENA_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+
+
+/******************************************************************************/
+/* RAM arena parameters                                                       */
+/******************************************************************************/
+
+/*
+ * RAM overlay shared by the application phases. Each phase allocates its
+ * buffers from the start of the same ARENA_SIZE bytes, so buffers only needed
+ * while the BLE module boots (SPI staging) and buffers only needed once the
+ * link runs (UART messages and events, sensor samples) occupy the same RAM.
+ * Phases only move forward and entering one releases everything the previous
+ * phase allocated. There is no free, a buffer lives until the phase ends.
+ *
+ * Debug builds (NDEBUG not defined) assert that allocations are made and
+ * checked in the current phase and overwrite released memory with
+ * ARENA_POISON so a stale user shows up quickly. ARENA_SIZE must cover the
+ * largest phase, Arena_Peak gives what was needed.
+ */
+#define ARENA_SIZE          1024         //bytes shared by the phases, multiple of 4
+#define ARENA_POISON        0xDDu        //fill of released memory in debug builds
+
+//application phases, in order
+#define ARENA_PHASE_BOOT    0            //from reset until the BLE module is booted
+#define ARENA_PHASE_RUN     1            //link up, until reset
+
+#if (((ARENA_SIZE) % 4) != 0)
+#error "ARENA_SIZE must be a multiple of 4"
+#endif
+
+//debug check that the buffers of _phase are still valid
+#define ARENA_CHECK(_phase) assert(Arena_Phase() == (_phase))
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//word aligned buffer for the current phase, NULL if the arena is full
+void *Arena_Alloc(uint8_t _phase, uint32_t _size);
+
+//end the current phase and release its buffers
+void Arena_Enter(uint8_t _phase);
+
+//current phase
+uint8_t Arena_Phase(void);
+
+//largest use of any phase so far, in bytes
+uint32_t Arena_Peak(void);
+
+#endif /* _RAM_ARENA_H_ */
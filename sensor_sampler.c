@@ -0,0 +1,340 @@
+
+#include <stddef.h>
+#include <adi_processor.h>
+#include <services/tmr/adi_tmr.h>
+#include <drivers/i2c/adi_i2c.h>
+
+#include "sensor_sampler.h"
+#include "ram_arena.h"
+#include "block_pool.h"
+#include "clock_governor.h"
+#include "idle_manager.h"
+
+/*
+ * Continuous sensor acquisition. A GP timer starts one I2C register read per
+ * period from its interrupt, the read is a one entry transaction list whose
+ * data phase is moved by the DMA straight into the next slot of a batch
+ * block, and the application is handed the block once its SAMPLER_BATCH_SIZE
+ * samples are filled. Nothing runs in the main loop while sampling. A period
+ * with no free block is skipped and counted as an overrun.
+ */
+
+ADI_TMR_RESULT          eTmrResult;//timer error variable
+ADI_I2C_RESULT          eSamplerI2cResult;//I2C error variable
+static uint8_t          TimerMem[ADI_TMR_MEMORY_SIZE];//timer memory size
+static ADI_TMR_HANDLE   hTimer;//timer handle
+static ADI_I2C_HANDLE   hSamplerI2c;//I2C master handle
+static SAMPLER_BATCH_CALLBACK pfBatchCallback;//application batch callback
+
+static uint32_t        *BatchMem = NULL;//SAMPLER_BATCHES batch blocks, run phase arena buffer
+static BLOCK_POOL       BatchPool;//batch blocks, freed by Sampler_ReleaseBatch
+static SAMPLER_SAMPLE  *pBatch = NULL;//batch being filled, NULL until the next period takes one
+static uint32_t         WriteIndex;//batch slot of the read in progress
+static volatile bool_t  bReadBusy = false;//a read is on the bus
+static volatile uint32_t Overruns;//periods skipped while a read was busy or no batch was free
+static volatile bool_t  bClockChange = false;//the clocks are changing, no read may start
+static bool_t           bClockListener = false;//registered with the clock governor
+
+static uint8_t          SampleReg;//register address sent before each read
+static ADI_I2C_TRANSACTION SampleXfer;//register read, Rx buffer points into the batch
+
+
+/********************************************************************
+* Timer Interrupt callback, start the read of the next sample        *
+*********************************************************************/
+static void SamplerTimerCallback(void *pCBParam, uint32_t Event, void *pArg)
+{
+  SAMPLER_SAMPLE *pSample;
+
+  if(Event != (uint32_t)ADI_TMR_EVENT_TIMEOUT)
+    return;
+
+  //previous read still on the bus or the clocks changing, skip this period
+  if(bReadBusy || bClockChange)
+  {
+    Overruns++;
+    return;
+  }
+
+  //every batch still with the application, skip this period
+  if(pBatch == NULL)
+  {
+    pBatch = (SAMPLER_SAMPLE *)BlockPool_Alloc(&BatchPool);
+    if(pBatch == NULL)
+    {
+      Overruns++;
+      return;
+    }
+  }
+
+  pSample = &pBatch[WriteIndex];
+
+  pSample->Timestamp = ClockGov_Cycles();
+  SampleXfer.pRxBuffer = pSample->Data;
+
+  bReadBusy = true;
+  if(adi_i2c_SubmitTransactionList(hSamplerI2c, &SampleXfer, 1u) != ADI_I2C_SUCCESS)
+  {
+    bReadBusy = false;
+    Overruns++;
+  }
+}
+
+
+/********************************************************************
+* Clock governor listener, keep the bus idle while PCLK changes      *
+*********************************************************************/
+static void SamplerClockChange(void *pCBParam, uint32_t Event, void *pArg)
+{
+  if(Event == CLOCK_GOV_EVENT_PRE_CHANGE)
+  {
+    bClockChange = true;
+    while(bReadBusy)
+    {
+    }
+  }
+  else
+  {
+    bClockChange = false;
+  }
+}
+
+
+/********************************************************************
+* I2C Interrupt callback, the read of the current sample is done     *
+*********************************************************************/
+static void SamplerI2cCallback(void *pCBParam, uint32_t Event, void *pArg)
+{
+  SAMPLER_SAMPLE *pFull;
+
+  if(Event != (uint32_t)ADI_I2C_EVENT_LIST_PROCESSED)
+    return;
+
+  pBatch[WriteIndex].Status = ((ADI_I2C_RESULT)(uint32_t)pArg == ADI_I2C_SUCCESS) ? 0u : 1u;
+
+  WriteIndex++;
+  pFull = NULL;
+  if(WriteIndex == SAMPLER_BATCH_SIZE)
+  {
+    pFull = pBatch;
+    pBatch = NULL;
+    WriteIndex = 0;
+  }
+
+  bReadBusy = false;
+
+  //hand over each filled batch, the application releases it
+  if(pFull != NULL)
+  {
+    if(pfBatchCallback != NULL)
+      pfBatchCallback(pFull, SAMPLER_BATCH_SIZE);
+    else
+      BlockPool_Free(&BatchPool, pFull);
+  }
+}
+
+
+/********************************************************************
+* Hand the I2C device back in blocking PIO mode                      *
+*********************************************************************/
+static void ReleaseI2c(void)
+{
+  adi_i2c_EnableDMA(hSamplerI2c, false);
+  adi_i2c_RegisterCallback(hSamplerI2c, NULL, NULL);
+}
+
+
+/********************************************************************
+* Open the periodic timer on HFOSC, PCLK follows the clock governor. *
+* Closed again if any step fails.                                    *
+*********************************************************************/
+static unsigned char StartTimer(uint16_t _ticks, ADI_TMR_PRESCALER _prescaler)
+{
+  eTmrResult = adi_tmr_Open(SAMPLER_TIMER_DEVICE, TimerMem, sizeof(TimerMem), &hTimer);
+  if(eTmrResult != ADI_TMR_SUCCESS)
+    return 1;
+
+  eTmrResult = adi_tmr_SetClockSource(hTimer, ADI_TMR_CLOCK_HFOSC);
+  if(eTmrResult == ADI_TMR_SUCCESS)
+    eTmrResult = adi_tmr_SetPrescaler(hTimer, _prescaler);
+  if(eTmrResult == ADI_TMR_SUCCESS)
+    eTmrResult = adi_tmr_SetCountMode(hTimer, ADI_TMR_COUNT_DOWN);
+  if(eTmrResult == ADI_TMR_SUCCESS)
+    eTmrResult = adi_tmr_SetRunMode(hTimer, ADI_TMR_PERIODIC_MODE);
+  if(eTmrResult == ADI_TMR_SUCCESS)
+    eTmrResult = adi_tmr_SetLoadValue(hTimer, _ticks);
+  if(eTmrResult == ADI_TMR_SUCCESS)
+    eTmrResult = adi_tmr_RegisterCallback(hTimer, SamplerTimerCallback, NULL);
+  if(eTmrResult == ADI_TMR_SUCCESS)
+    eTmrResult = adi_tmr_Enable(hTimer, true);
+
+  if(eTmrResult != ADI_TMR_SUCCESS)
+  {
+    adi_tmr_Close(hTimer);
+    return 1;
+  }
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Sampler_Start
+* Description  : This function starts reading SAMPLER_DATA_SIZE bytes from register _reg of
+*                the I2C slave _slaveAddr every _periodUs microseconds. GP timer
+*                SAMPLER_TIMER_DEVICE paces the reads and the I2C data lands through the DMA
+*                in pool blocks of timestamped samples. _callback is called from interrupt
+*                context with each block once its SAMPLER_BATCH_SIZE samples are filled and
+*                owns it until Sampler_ReleaseBatch.
+*                The I2C device must be an open, idle master and is owned by the sampler
+*                until Sampler_Stop.
+* Arguments    : ADI_I2C_HANDLE _hI2c = I2C master handle
+*                uint16_t _slaveAddr = slave address
+*                uint8_t _reg = first register to read
+*                uint32_t _periodUs = sampling period (1us to about 645000us, HFOSC keeps it across clock changes)
+*                SAMPLER_BATCH_CALLBACK _callback = batch notification
+* Return Value : 0 = Success
+*                1 = Failure (period out of range, or see eTmrResult/eSamplerI2cResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Sampler_Start(ADI_I2C_HANDLE _hI2c, uint16_t _slaveAddr, uint8_t _reg, uint32_t _periodUs, SAMPLER_BATCH_CALLBACK _callback)
+{
+  static const uint16_t   Dividers[] = {16u, 64u, 256u};
+  static const ADI_TMR_PRESCALER Prescalers[] = {ADI_GPT_PRESCALER_16, ADI_GPT_PRESCALER_64, ADI_GPT_PRESCALER_256};
+  uint64_t ticks = 0u;
+  uint32_t i;
+
+  //smallest prescaler that fits the period in the 16 bit counter, in 64 bits
+  //so a period out of range is refused instead of wrapping
+  for(i = 0; i < (sizeof(Dividers) / sizeof(Dividers[0])); i++)
+  {
+    ticks = ((uint64_t)CLOCK_GOV_ROOT_HZ * _periodUs) / ((uint64_t)Dividers[i] * 1000000u);
+    if(ticks <= 0xFFFFu)
+      break;
+  }
+  if((ticks == 0u) || (ticks > 0xFFFFu))
+    return 1;
+
+  //the pool is set up once, batches held by the application stay valid across restarts
+  if(BatchMem == NULL)
+  {
+    BatchMem = Arena_Alloc(ARENA_PHASE_RUN, BLOCK_POOL_STORAGE_SIZE(SAMPLER_BATCH_SIZE * sizeof(SAMPLER_SAMPLE), SAMPLER_BATCHES));
+    if(BlockPool_Init(&BatchPool, "samples", BatchMem, SAMPLER_BATCH_SIZE * sizeof(SAMPLER_SAMPLE), SAMPLER_BATCHES) != 0)
+    {
+      BatchMem = NULL;
+      return 1;
+    }
+  }
+
+  hSamplerI2c = _hI2c;
+  pfBatchCallback = _callback;
+  WriteIndex = 0;
+  Overruns = 0;
+  bReadBusy = false;
+
+  //register address write, repeated start, data read
+  SampleReg = _reg;
+  SampleXfer.pTxBuffer = &SampleReg;
+  SampleXfer.pRxBuffer = NULL;
+  SampleXfer.nSlaveAddr = _slaveAddr;
+  SampleXfer.nTxSize = 1u;
+  SampleXfer.nRxSize = SAMPLER_DATA_SIZE;
+  SampleXfer.bRestart = true;
+
+  //completion through the callback, data through the DMA
+  eSamplerI2cResult = adi_i2c_RegisterCallback(hSamplerI2c, SamplerI2cCallback, NULL);
+  if(eSamplerI2cResult != ADI_I2C_SUCCESS)
+    return 1;
+
+  eSamplerI2cResult = adi_i2c_EnableDMA(hSamplerI2c, true);
+  if(eSamplerI2cResult != ADI_I2C_SUCCESS)
+  {
+    ReleaseI2c();
+    return 1;
+  }
+
+  //no read on the bus while the clock governor changes PCLK
+  if(bClockListener == false)
+  {
+    if(ClockGov_Register(SamplerClockChange, NULL) != 0)
+    {
+      ReleaseI2c();
+      return 1;
+    }
+    bClockListener = true;
+  }
+
+  if(StartTimer((uint16_t)ticks, Prescalers[i]) != 0)
+  {
+    ReleaseI2c();
+    return 1;
+  }
+
+  //the timer and the I2C transfers stop in hibernate
+  Idle_Hold(IDLE_MODE_FLEXI);
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Sampler_Stop
+* Description  : This function stops the timer, waits for the read in progress and hands the
+*                I2C device back in blocking PIO mode
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (See eTmrResult/eSamplerI2cResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char Sampler_Stop(void)
+{
+  eTmrResult = adi_tmr_Enable(hTimer, false);
+  if(eTmrResult != ADI_TMR_SUCCESS)
+    return 1;
+
+  eTmrResult = adi_tmr_Close(hTimer);
+  if(eTmrResult != ADI_TMR_SUCCESS)
+    return 1;
+  Idle_Release(IDLE_MODE_FLEXI);
+
+  //wait for the last read, then drop the partial batch
+  while(bReadBusy)
+  {
+  }
+  BlockPool_Free(&BatchPool, pBatch);
+  pBatch = NULL;
+  WriteIndex = 0;
+
+  eSamplerI2cResult = adi_i2c_EnableDMA(hSamplerI2c, false);
+  if(eSamplerI2cResult != ADI_I2C_SUCCESS)
+    return 1;
+
+  eSamplerI2cResult = adi_i2c_RegisterCallback(hSamplerI2c, NULL, NULL);
+  if(eSamplerI2cResult != ADI_I2C_SUCCESS)
+    return 1;
+
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Sampler_ReleaseBatch
+* Description  : This function gives a batch handed over by the batch callback back to the
+*                sampler. The samples must not be used afterwards.
+* Arguments    : SAMPLER_SAMPLE const* _batch = batch from the callback, NULL is ignored
+* Return Value : void
+**********************************************************************************************/
+void Sampler_ReleaseBatch(SAMPLER_SAMPLE const * _batch)
+{
+  BlockPool_Free(&BatchPool, (void *)_batch);
+}
+
+
+/**********************************************************************************************
+* Function Name: Sampler_GetOverruns
+* Description  : This function returns the number of periods skipped because the previous
+*                read was still on the bus, no batch block was free or the read could not
+*                be started
+* Arguments    : void
+* Return Value : number of skipped periods since Sampler_Start
+**********************************************************************************************/
+uint32_t Sampler_GetOverruns(void)
+{
+  return Overruns;
+}
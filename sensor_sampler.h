@@ -0,0 +1,55 @@
+
+#ifndef _SENSOR_SAMPLER_H_
+#define _SENSOR_SAMPLER_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include <drivers/i2c/adi_i2c.h>
+
+
+/******************************************************************************/
+/* sampler parameters                                                         */
+/******************************************************************************/
+
+#define SAMPLER_TIMER_DEVICE    0        //GP timer that triggers the reads
+#define SAMPLER_DATA_SIZE       2        //register bytes read per sample
+#define SAMPLER_BATCHES         4        //batch blocks in the pool, filled or being filled, MUST BE A POWER OF TWO
+#define SAMPLER_BATCH_SIZE      8        //samples per notification
+
+/******************************************************************************/
+/* Types                                                                      */
+/******************************************************************************/
+
+//one timestamped sensor read
+typedef struct
+{
+  uint32_t Timestamp;                 //ClockGov_Cycles when the read was triggered
+  uint8_t  Data[SAMPLER_DATA_SIZE];   //register bytes as read from the sensor
+  uint8_t  Status;                    //0 = read ok, 1 = bus error
+} SAMPLER_SAMPLE;
+
+//called from interrupt context each time SAMPLER_BATCH_SIZE samples are filled,
+//the batch belongs to the callee until it is given to Sampler_ReleaseBatch
+typedef void (*SAMPLER_BATCH_CALLBACK)(SAMPLER_SAMPLE const * _batch, uint32_t _count);
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//start reading SAMPLER_DATA_SIZE register bytes from _reg of an I2C slave every _periodUs
+unsigned char Sampler_Start(ADI_I2C_HANDLE _hI2c, uint16_t _slaveAddr, uint8_t _reg, uint32_t _periodUs, SAMPLER_BATCH_CALLBACK _callback);
+
+//stop the sampling and release the I2C device
+unsigned char Sampler_Stop(void);
+
+//give a batch back to the sampler, any context
+void Sampler_ReleaseBatch(SAMPLER_SAMPLE const * _batch);
+
+//number of periods skipped because the previous read was still running or no batch was free
+uint32_t Sampler_GetOverruns(void);
+
+#endif /* _SENSOR_SAMPLER_H_ */
@@ -0,0 +1,149 @@
+
+#ifndef _SPSC_RING_H_
+#define _SPSC_RING_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include <adi_processor.h>
+#include "adi_types.h"
+
+/*
+ * Lock-free single producer / single consumer ring for handing data from an
+ * interrupt to the main loop (or the other way round).
+ *
+ * The head index is only written by the producer and the tail index only by
+ * the consumer. Both run freely and wrap at 2^32, the element count is a power
+ * of two so a slot is found with a mask and head - tail is always the fill
+ * level. A 32 bit store is atomic on the Cortex-M3 so no critical region is
+ * needed, the DMB orders the slot data against the index that publishes it.
+ *
+ * Either side can work in place with WriteSlot/Commit and ReadSlot/Release,
+ * for example to let a driver fill the slot directly, or copy with Push/Pop.
+ */
+
+/******************************************************************************/
+/* Types                                                                      */
+/******************************************************************************/
+
+typedef struct
+{
+  uint8_t           *pStorage;        //element storage, count * element size bytes
+  uint32_t           nElemSize;       //bytes per element
+  uint32_t           nMask;           //element count - 1
+  volatile uint32_t  nHead;           //next slot to write, producer only
+  volatile uint32_t  nTail;           //next slot to read, consumer only
+} SPSC_RING;
+
+//true when _n is a non zero power of two
+#define SPSC_RING_IS_POW2(_n)   (((_n) != 0u) && ((((_n) - 1u) & (_n)) == 0u))
+
+
+/******************************************************************************/
+/* Functions                                                                  */
+/******************************************************************************/
+
+/**********************************************************************************************
+* Function Name: SpscRing_Init
+* Description  : This function attaches _count elements of _elemSize bytes at _storage to
+*                an empty ring. Must be called before either side uses the ring.
+* Arguments    : SPSC_RING* _ring = ring to initialise
+*                void* _storage = element storage, at least _count * _elemSize bytes
+*                uint32_t _elemSize = bytes per element
+*                uint32_t _count = number of elements, MUST BE A POWER OF TWO
+* Return Value : 0 = Success
+*                1 = Failure (_count is not a power of two)
+**********************************************************************************************/
+static __INLINE unsigned char SpscRing_Init(SPSC_RING *_ring, void *_storage, uint32_t _elemSize, uint32_t _count)
+{
+  if(!SPSC_RING_IS_POW2(_count))
+    return 1;
+
+  _ring->pStorage = (uint8_t *)_storage;
+  _ring->nElemSize = _elemSize;
+  _ring->nMask = _count - 1u;
+  _ring->nHead = 0u;
+  _ring->nTail = 0u;
+
+  return 0;
+}
+
+//number of elements waiting to be read
+static __INLINE uint32_t SpscRing_Count(SPSC_RING const *_ring)
+{
+  return _ring->nHead - _ring->nTail;
+}
+
+//producer: free slot to fill in place, NULL when the ring is full
+static __INLINE void *SpscRing_WriteSlot(SPSC_RING *_ring)
+{
+  uint32_t head = _ring->nHead;
+
+  if((head - _ring->nTail) > _ring->nMask)
+    return NULL;
+
+  return &_ring->pStorage[(head & _ring->nMask) * _ring->nElemSize];
+}
+
+//producer: publish the slot returned by SpscRing_WriteSlot
+static __INLINE void SpscRing_Commit(SPSC_RING *_ring)
+{
+  __DMB();
+  _ring->nHead = _ring->nHead + 1u;
+}
+
+//consumer: oldest element to read in place, NULL when the ring is empty
+static __INLINE void *SpscRing_ReadSlot(SPSC_RING *_ring)
+{
+  uint32_t tail = _ring->nTail;
+
+  if(_ring->nHead == tail)
+    return NULL;
+
+  __DMB();
+  return &_ring->pStorage[(tail & _ring->nMask) * _ring->nElemSize];
+}
+
+//consumer: hand the slot returned by SpscRing_ReadSlot back to the producer
+static __INLINE void SpscRing_Release(SPSC_RING *_ring)
+{
+  __DMB();
+  _ring->nTail = _ring->nTail + 1u;
+}
+
+//consumer: drop everything published so far
+static __INLINE void SpscRing_Flush(SPSC_RING *_ring)
+{
+  _ring->nTail = _ring->nHead;
+}
+
+//producer: copy one element in, 0 = Success, 1 = ring full
+static __INLINE unsigned char SpscRing_Push(SPSC_RING *_ring, void const *_elem)
+{
+  void *slot = SpscRing_WriteSlot(_ring);
+
+  if(slot == NULL)
+    return 1;
+
+  memcpy(slot, _elem, _ring->nElemSize);
+  SpscRing_Commit(_ring);
+  return 0;
+}
+
+//consumer: copy the oldest element out, 0 = Success, 1 = ring empty
+static __INLINE unsigned char SpscRing_Pop(SPSC_RING *_ring, void *_elem)
+{
+  void const *slot = SpscRing_ReadSlot(_ring);
+
+  if(slot == NULL)
+    return 1;
+
+  memcpy(_elem, slot, _ring->nElemSize);
+  SpscRing_Release(_ring);
+  return 0;
+}
+
+#endif /* _SPSC_RING_H_ */
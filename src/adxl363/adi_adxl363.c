@@ -0,0 +1,1224 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_adxl363.c
+ * @brief:   ADXL363 accelerometer driver using SPI read-command mode
+ *-----------------------------------------------------------------------------
+ *
+ * All register and FIFO reads are issued as a single SPI read-command
+ * transaction: the controller sends the instruction (and address) and then
+ * clocks in the data in the same CS frame without CPU involvement between
+ * the command and data phases.
+ *
+ *****************************************************************************/
+
+#include <string.h>
+#include <stddef.h>
+#include <services/int/adi_int.h>
+#include <drivers/accel/adxl363/adi_adxl363.h>
+
+#include "adi_adxl363_def.h"
+
+/* SPI service of the application, Communications.c. Register and FIFO reads
+ * are issued through its read-command transaction. */
+extern ADI_SPI_HANDLE Spi_GetHandle(void);
+extern unsigned char Spi_ReadRegister(uint8_t const *_command, uint8_t _commandLength, uint8_t *_arrayR, uint16_t _lengthR);
+
+#ifdef __ICCARM__
+/*
+* IAR MISRA C 2004 error suppressions.
+*
+* Pm073 (rule 14.7): a function should have a single point of exit
+* Pm143 (rule 14.7): a function should have a single point of exit at the end of the function
+*   Multiple returns are used for error handling.
+*/
+#pragma diag_suppress=Pm073,Pm143
+#endif /* __ICCARM__ */
+
+/*==========  D A T A  ==========*/
+
+static ADI_ADXL363_DEV_DATA *adxl363_Device[ADI_ADXL363_NUM_INSTANCES];
+
+/* handle checker for debug mode */
+#ifdef ADI_DEBUG
+#define ADI_ADXL363_INVALID_HANDLE(h)                                       \
+    ((adxl363_Device[0] != (ADI_ADXL363_DEV_DATA *)(h)) || ((h) == NULL))
+#endif
+
+/*==========  L O C A L   F U N C T I O N S  ==========*/
+
+static ADI_ADXL363_RESULT CommandRead   (ADI_ADXL363_DEV_DATA *pDev, uint8_t nCmdBytes, uint8_t *pData, uint32_t nSize);
+static ADI_ADXL363_RESULT ReadRegs      (ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint8_t *pData, uint32_t nSize);
+static ADI_ADXL363_RESULT WriteReg      (ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint8_t nValue);
+static ADI_ADXL363_RESULT ModifyReg     (ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint8_t nMask, uint8_t nValue);
+static ADI_ADXL363_RESULT WriteReg16    (ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint16_t nValue);
+static void               GPIOCallback  (void *pCBParam, uint32_t Event, void *pArg);
+
+#if (ADI_ADXL363_ENABLE_STATIC_CONFIG_SUPPORT == 1)
+static ADI_ADXL363_RESULT StaticConfig  (ADI_ADXL363_DEV_DATA *pDev);
+#endif
+
+/*
+ * Issue a read-command transaction. The first nCmdBytes of pDev->aCommand are
+ * sent, then nSize bytes are clocked in, both phases in one Spi_ReadRegister
+ * transaction of the SPI service.
+ */
+static ADI_ADXL363_RESULT CommandRead(ADI_ADXL363_DEV_DATA *pDev, uint8_t nCmdBytes, uint8_t *pData, uint32_t nSize)
+{
+    unsigned char nResult;
+
+    if (pDev->bPendingIO != 0u)
+    {
+        return ADI_ADXL363_PENDING_IO;
+    }
+    if (nSize > 0xFFFFu)
+    {
+        return ADI_ADXL363_DEVICE_ACCESS_FAILED;
+    }
+    pDev->bPendingIO = 1u;
+
+    nResult = Spi_ReadRegister(pDev->aCommand, nCmdBytes, pData, (uint16_t)nSize);
+
+    pDev->bPendingIO = 0u;
+
+    return (nResult == 0u) ? ADI_ADXL363_SUCCESS : ADI_ADXL363_DEVICE_ACCESS_FAILED;
+}
+
+/*
+ * Burst read nSize consecutive registers starting at nAddress.
+ */
+static ADI_ADXL363_RESULT ReadRegs(ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint8_t *pData, uint32_t nSize)
+{
+    pDev->aCommand[0] = ADI_ADXL363_CMD_READ_REG;
+    pDev->aCommand[1] = nAddress;
+
+    return CommandRead(pDev, 2u, pData, nSize);
+}
+
+/*
+ * Write a single register.
+ */
+static ADI_ADXL363_RESULT WriteReg(ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint8_t nValue)
+{
+    ADI_SPI_TRANSCEIVER xfr;
+    ADI_SPI_RESULT      eSpiResult;
+
+    if (pDev->bPendingIO != 0u)
+    {
+        return ADI_ADXL363_PENDING_IO;
+    }
+    pDev->bPendingIO = 1u;
+
+    pDev->aCommand[0] = ADI_ADXL363_CMD_WRITE_REG;
+    pDev->aCommand[1] = nAddress;
+    pDev->aCommand[2] = nValue;
+
+    xfr.pTransmitter     = pDev->aCommand;
+    xfr.TransmitterBytes = 3u;
+    xfr.pReceiver        = NULL;
+    xfr.ReceiverBytes    = 0u;
+    xfr.nTxIncrement     = true;
+    xfr.nRxIncrement     = false;
+
+    eSpiResult = adi_spi_ReadWrite(pDev->hSPIDevice, &xfr);
+    pDev->bPendingIO = 0u;
+
+    return (eSpiResult == ADI_SPI_SUCCESS) ? ADI_ADXL363_SUCCESS : ADI_ADXL363_DEVICE_ACCESS_FAILED;
+}
+
+/*
+ * Write a 16 bit value to a L/H register pair.
+ */
+static ADI_ADXL363_RESULT WriteReg16(ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint16_t nValue)
+{
+    ADI_ADXL363_RESULT eResult;
+
+    if ((eResult = WriteReg(pDev, nAddress, (uint8_t)(nValue & 0xFFu))) != ADI_ADXL363_SUCCESS)
+    {
+        return eResult;
+    }
+    return WriteReg(pDev, nAddress + 1u, (uint8_t)(nValue >> 8u));
+}
+
+/*
+ * Read-modify-write the bits selected by nMask.
+ */
+static ADI_ADXL363_RESULT ModifyReg(ADI_ADXL363_DEV_DATA *pDev, uint8_t nAddress, uint8_t nMask, uint8_t nValue)
+{
+    ADI_ADXL363_RESULT eResult;
+    uint8_t nReg;
+
+    if ((eResult = ReadRegs(pDev, nAddress, &nReg, 1u)) != ADI_ADXL363_SUCCESS)
+    {
+        return eResult;
+    }
+    nReg = (uint8_t)((nReg & (uint8_t)~nMask) | (nValue & nMask));
+
+    return WriteReg(pDev, nAddress, nReg);
+}
+
+/*
+ * GPIO interrupt callback for the INT1/INT2 pins.
+ */
+static void GPIOCallback(void *pCBParam, uint32_t Event, void *pArg)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)pCBParam;
+
+    if (pDev->pfCallback == NULL)
+    {
+        return;
+    }
+    if (Event == pDev->aIntIrq[ADI_ADXL363_INTPIN1])
+    {
+        pDev->pfCallback(pDev->pCBParam, (uint32_t)ADI_ADXL363_EVENT_INT1, pArg);
+    }
+    if (Event == pDev->aIntIrq[ADI_ADXL363_INTPIN2])
+    {
+        pDev->pfCallback(pDev->pCBParam, (uint32_t)ADI_ADXL363_EVENT_INT2, pArg);
+    }
+}
+
+#if (ADI_ADXL363_ENABLE_STATIC_CONFIG_SUPPORT == 1)
+/*
+ * Apply the adi_adxl363_config.h settings.
+ */
+static ADI_ADXL363_RESULT StaticConfig(ADI_ADXL363_DEV_DATA *pDev)
+{
+    ADI_ADXL363_RESULT eResult;
+    uint8_t nActInactCtl;
+    uint8_t nFilterCtl;
+    uint8_t nPowerCtl;
+
+    nActInactCtl = (uint8_t)( (ADXL363_CFG_ENABLE_ACTIVITY   << BITP_ADXL363_ACT_EN)
+                            | (ADXL363_CFG_ACTIVITY_MODE     << BITP_ADXL363_ACT_REF)
+                            | (ADXL363_CFG_ENABLE_INACTIVITY << BITP_ADXL363_INACT_EN)
+                            | (ADXL363_CFG_INACTIVITY_MODE   << BITP_ADXL363_INACT_REF)
+                            | (ADXL363_CFG_LINK_LOOP_MODE    << BITP_ADXL363_LINK_LOOP));
+
+    pDev->nFIFOCtl = (uint8_t)( (ADXL363_CFG_FIFO_MODE               << BITP_ADXL363_FIFO_MODE)
+                              | (ADXL363_CFG_ENABLE_TEMPERATURE_FIFO << BITP_ADXL363_TEMP_FIFO_EN)
+                              | (((ADXL363_CFG_FIFO_SIZE >> 8u) & 1u) << BITP_ADXL363_FIFO_HALF));
+
+    nFilterCtl = (uint8_t)( (ADXL363_CFG_OUTPUT_DATARATE   << BITP_ADXL363_ODR)
+                          | (ADXL363_CFG_FILTER_BW         << BITP_ADXL363_HALF_BW_EN)
+                          | (ADXL363_CFG_MEASUREMENT_RANGE << BITP_ADXL363_RNAGE));
+
+    nPowerCtl = (uint8_t)( (ADXL363_CFG_ENABLE_MEASUREMENT << BITP_ADXL363_MEASURE_EN)
+                         | (ADXL363_CFG_ENABLE_AUTOSLEEP   << BITP_ADXL363_AUTO_SLEEP)
+                         | (ADXL363_CFG_ENABLE_WAKEUP_MODE << BITP_ADXL363_WAKE_UP)
+                         | (ADXL363_CFG_NOISE_MODE         << BITP_ADXL363_LOW_NOISE));
+
+    if (   ((eResult = WriteReg16(pDev, ADI_ADXL363_THRESH_ACT_L,   ADXL363_CFG_ACTIVITY_THRESHOLD))   != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_TIME_ACT,       ADXL363_CFG_ACTIVITY_TIME))        != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg16(pDev, ADI_ADXL363_THRESH_INACT_L, ADXL363_CFG_INACTIVITY_THRESHOLD)) != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg16(pDev, ADI_ADXL363_TIME_INACT_L,   ADXL363_CFG_INACTIVITY_TIME))      != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_ACT_INACT_CTL,  nActInactCtl))                    != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_FIFO_SAMPLES,   (uint8_t)(ADXL363_CFG_FIFO_SIZE & 0xFFu))) != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_FIFO_CTL,       pDev->nFIFOCtl))                  != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_INT1_MAP,       ADXL363_CFG_INT1_MAP))             != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_INT2_MAP,       ADXL363_CFG_INT2_MAP))             != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_FILTER_CTL,     nFilterCtl))                      != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg  (pDev, ADI_ADXL363_POWER_CTL,      nPowerCtl))                       != ADI_ADXL363_SUCCESS))
+    {
+        return eResult;
+    }
+
+    if (ADXL363_CFG_ENABLE_MEASUREMENT != 0)
+    {
+        pDev->eState = (uint8_t)ADI_ADXL363_STATE_MEASURING;
+    }
+    return ADI_ADXL363_SUCCESS;
+}
+#endif /* ADI_ADXL363_ENABLE_STATIC_CONFIG_SUPPORT */
+
+/*! \addtogroup adxl363_Driver
+ *  @{
+ */
+
+/*!
+ * @brief       Open the ADXL363 device.
+ *
+ * @param[in]   nDeviceNum      Device instance number (0).
+ * @param[in]   pDeviceMemory   Word aligned memory of at least #ADI_ADXL363_MEMORY_SIZE bytes.
+ * @param[in]   nMemSize        Size of pDeviceMemory.
+ * @param[in]   pfCallback      Callback for #ADI_ADXL363_EVENT, may be NULL.
+ * @param[in]   pCBParam        Parameter passed back in the callback.
+ * @param[in]   hSPIDevice      SPI master handle the ADXL363 is attached to, the one
+ *                              opened by Spi_Init (Spi_GetHandle()).
+ * @param[out]  phDevice        Returned device handle.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Device opened.
+ *              - #ADI_ADXL363_INVALID_DEVICE_NUM [D]   nDeviceNum out of range.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         A pointer parameter is NULL.
+ *              - #ADI_ADXL363_UNALIGNED_MEM_PTR [D]    pDeviceMemory not word aligned.
+ *              - #ADI_ADXL363_INSUFFICIENT_MEMORY [D]  nMemSize too small.
+ *              - #ADI_ADXL363_DEVICE_ALREADY_OPENED [D] Instance already opened.
+ *              - #ADI_ADXL363_SPI_DEV_FAILED           Not the SPI service handle, or SPI configuration failed.
+ *              - #ADI_ADXL363_HW_ERROR                 Device ID mismatch.
+ *
+ * The SPI device is switched to interrupt mode so read-command transactions of
+ * any length (FIFO bursts) can be issued. Reads go through Spi_ReadRegister,
+ * which uses the handle of the SPI service, so hSPIDevice must be that handle.
+ */
+ADI_ADXL363_RESULT adi_adxl363_Open (
+    uint32_t                        nDeviceNum,
+    void * const                    pDeviceMemory,
+    uint32_t                        nMemSize,
+    ADI_CALLBACK                    pfCallback,
+    void * const                    pCBParam,
+    ADI_SPI_HANDLE                  hSPIDevice,
+    ADI_ADXL363_HANDLE * const      phDevice
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)pDeviceMemory;
+    ADI_ADXL363_RESULT eResult;
+    uint8_t nDevId;
+
+#ifdef ADI_DEBUG
+    if (nDeviceNum >= ADI_ADXL363_NUM_INSTANCES)
+    {
+        return ADI_ADXL363_INVALID_DEVICE_NUM;
+    }
+    if ((pDeviceMemory == NULL) || (phDevice == NULL) || (hSPIDevice == NULL))
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+    if (((uint32_t)pDeviceMemory & 0x3u) != 0u)
+    {
+        return ADI_ADXL363_UNALIGNED_MEM_PTR;
+    }
+    if ((nMemSize < ADI_ADXL363_MEMORY_SIZE) || (sizeof(ADI_ADXL363_DEV_DATA) > ADI_ADXL363_MEMORY_SIZE))
+    {
+        return ADI_ADXL363_INSUFFICIENT_MEMORY;
+    }
+    if (adxl363_Device[nDeviceNum] != NULL)
+    {
+        return ADI_ADXL363_DEVICE_ALREADY_OPENED;
+    }
+#endif /* ADI_DEBUG */
+
+    *phDevice = NULL;
+
+    if (hSPIDevice != Spi_GetHandle())
+    {
+        return ADI_ADXL363_SPI_DEV_FAILED;
+    }
+
+    memset(pDev, 0, sizeof(ADI_ADXL363_DEV_DATA));
+    pDev->hSPIDevice = hSPIDevice;
+    pDev->pfCallback = pfCallback;
+    pDev->pCBParam   = pCBParam;
+    pDev->eState     = (uint8_t)ADI_ADXL363_STATE_STANDBY;
+    pDev->aIntIrq[ADI_ADXL363_INTPIN1] = ADI_ADXL363_IRQ_NONE;
+    pDev->aIntIrq[ADI_ADXL363_INTPIN2] = ADI_ADXL363_IRQ_NONE;
+
+    if (   (adi_spi_SetChipSelect(hSPIDevice, ADXL363_CFG_SPI_DEV_CS) != ADI_SPI_SUCCESS)
+        || (adi_spi_SetBitrate(hSPIDevice, ADXL363_CFG_SPI_DEV_BITRATE) != ADI_SPI_SUCCESS)
+        || (adi_spi_SetContinousMode(hSPIDevice, true) != ADI_SPI_SUCCESS)
+        || (adi_spi_EnableDmaMode(hSPIDevice, false) != ADI_SPI_SUCCESS))
+    {
+        return ADI_ADXL363_SPI_DEV_FAILED;
+    }
+
+    if ((eResult = ReadRegs(pDev, ADI_ADXL363_ADI_DEVID, &nDevId, 1u)) != ADI_ADXL363_SUCCESS)
+    {
+        return eResult;
+    }
+    if (nDevId != 0xADu)
+    {
+        return ADI_ADXL363_HW_ERROR;
+    }
+
+#if (ADI_ADXL363_ENABLE_STATIC_CONFIG_SUPPORT == 1)
+    if ((eResult = StaticConfig(pDev)) != ADI_ADXL363_SUCCESS)
+    {
+        return eResult;
+    }
+#endif
+
+    adxl363_Device[nDeviceNum] = pDev;
+    *phDevice = (ADI_ADXL363_HANDLE)pDev;
+
+    return ADI_ADXL363_SUCCESS;
+}
+
+/*!
+ * @brief       Close the ADXL363 device. The device is put in standby and the
+ *              GPIO callbacks are released. The SPI handle is left open.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Device closed.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Failed to enter standby.
+ */
+ADI_ADXL363_RESULT adi_adxl363_Close (
+    ADI_ADXL363_HANDLE  const       hDevice
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    ADI_ADXL363_RESULT eResult;
+    uint32_t i;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    eResult = adi_adxl363_Enable(hDevice, false);
+
+    for (i = 0u; i < 2u; i++)
+    {
+        if (pDev->aIntIrq[i] != ADI_ADXL363_IRQ_NONE)
+        {
+            adi_gpio_RegisterCallback((IRQn_Type)pDev->aIntIrq[i], NULL, NULL);
+        }
+    }
+
+    pDev->eState = (uint8_t)ADI_ADXL363_STATE_NOT_OPENED;
+    adxl363_Device[0] = NULL;
+
+    return eResult;
+}
+
+/*!
+ * @brief       Start or stop measurement.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enter measurement mode, false for standby.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_Enable(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    ADI_ADXL363_RESULT eResult;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    eResult = ModifyReg(pDev, ADI_ADXL363_POWER_CTL, BITM_ADXL363_MEASURE_EN,
+                        (bEnable == true) ? ADI_ADXL363_MEASURE_ON : ADI_ADXL363_MEASURE_STANDBY);
+    if (eResult == ADI_ADXL363_SUCCESS)
+    {
+        pDev->eState = (uint8_t)((bEnable == true) ? ADI_ADXL363_STATE_MEASURING : ADI_ADXL363_STATE_STANDBY);
+    }
+    return eResult;
+}
+
+/*!
+ * @brief       Read acceleration data (blocking).
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[out]  pBuffer     Buffer for the data.
+ * @param[in]   nSize       Number of bytes to read.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         pBuffer is NULL.
+ *              - #ADI_ADXL363_INVALID_OPERATION [D]    Device is not measuring.
+ *              - #ADI_ADXL363_PENDING_IO               Another transfer is in progress.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Transfer failed.
+ *
+ * When the FIFO is enabled the data is burst read from the FIFO as 16 bit
+ * little endian entries (2 bits axis tag, 14 bits data) in one read-command
+ * transaction. Otherwise the X/Y/Z (and temperature) data registers are burst
+ * read starting at DATAX_L.
+ */
+ADI_ADXL363_RESULT adi_adxl363_Read (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    void *const                     pBuffer,
+    uint32_t const                  nSize
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+    if (pBuffer == NULL)
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+    if (pDev->eState != (uint8_t)ADI_ADXL363_STATE_MEASURING)
+    {
+        return ADI_ADXL363_INVALID_OPERATION;
+    }
+#endif
+
+    if ((pDev->nFIFOCtl & BITM_ADXL363_FIFO_MODE) != (uint8_t)ADI_ADXL363_DISABLE_FIFO)
+    {
+        pDev->aCommand[0] = ADI_ADXL363_CMD_READ_FIFO;
+        return CommandRead(pDev, 1u, (uint8_t *)pBuffer, nSize);
+    }
+
+    return ReadRegs(pDev, ADI_ADXL363_DATAX_L, (uint8_t *)pBuffer, nSize);
+}
+
+/*!
+ * @brief       Set the output data rate.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eDataRate   Output data rate.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_SetDataRate (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_ADXL363_DATA_RATE           eDataRate
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_FILTER_CTL, BITM_ADXL363_ODR,
+                     (uint8_t)((uint8_t)eDataRate << BITP_ADXL363_ODR));
+}
+
+/*!
+ * @brief       Configure activity detection.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   nThreshold  Activity threshold (11 bit).
+ * @param[in]   nTime       Activity time in samples.
+ * @param[in]   eMode       Absolute or referenced detection.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_INVALID_ACT_THRESH       Threshold out of range.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ConfigActivity (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    uint16_t                        nThreshold,
+    uint8_t                         nTime,
+    ADI_ADXL363_DETECTION_MODE      eMode
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    ADI_ADXL363_RESULT eResult;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+    if (nThreshold > ADI_ADXL363_MAX_THRESHOLD)
+    {
+        return ADI_ADXL363_INVALID_ACT_THRESH;
+    }
+
+    if (   ((eResult = WriteReg16(pDev, ADI_ADXL363_THRESH_ACT_L, nThreshold)) != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg(pDev, ADI_ADXL363_TIME_ACT, nTime)) != ADI_ADXL363_SUCCESS))
+    {
+        return eResult;
+    }
+
+    return ModifyReg(pDev, ADI_ADXL363_ACT_INACT_CTL, BITM_ADXL363_ACT_REF,
+                     (uint8_t)((uint8_t)eMode << BITP_ADXL363_ACT_REF));
+}
+
+/*!
+ * @brief       Enable or disable activity detection.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enable.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_EnableActivity(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_ACT_INACT_CTL, BITM_ADXL363_ACT_EN,
+                     (bEnable == true) ? BITM_ADXL363_ACT_EN : 0u);
+}
+
+/*!
+ * @brief       Configure inactivity detection.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   nThreshold  Inactivity threshold (11 bit).
+ * @param[in]   nTime       Inactivity time in samples.
+ * @param[in]   eMode       Absolute or referenced detection.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_INVALID_INACT_THRESH     Threshold out of range.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ConfigInactivity (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    uint16_t                        nThreshold,
+    uint16_t                        nTime,
+    ADI_ADXL363_DETECTION_MODE      eMode
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    ADI_ADXL363_RESULT eResult;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+    if (nThreshold > ADI_ADXL363_MAX_THRESHOLD)
+    {
+        return ADI_ADXL363_INVALID_INACT_THRESH;
+    }
+
+    if (   ((eResult = WriteReg16(pDev, ADI_ADXL363_THRESH_INACT_L, nThreshold)) != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg16(pDev, ADI_ADXL363_TIME_INACT_L, nTime)) != ADI_ADXL363_SUCCESS))
+    {
+        return eResult;
+    }
+
+    return ModifyReg(pDev, ADI_ADXL363_ACT_INACT_CTL, BITM_ADXL363_INACT_REF,
+                     (uint8_t)((uint8_t)eMode << BITP_ADXL363_INACT_REF));
+}
+
+/*!
+ * @brief       Select normal, linked or loop activity/inactivity mode.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eMode       Activity/inactivity mode.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ActInactMode (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_ACT_INACT_MODE              eMode
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_ACT_INACT_CTL, BITM_ADXL363_LINK_LOOP,
+                     (uint8_t)eMode);
+}
+
+/*!
+ * @brief       Enable or disable inactivity detection.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enable.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_EnableInactivity(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_ACT_INACT_CTL, BITM_ADXL363_INACT_EN,
+                     (bEnable == true) ? BITM_ADXL363_INACT_EN : 0u);
+}
+
+/*!
+ * @brief       Enable or disable wake-up mode.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enable.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_EnableWakeUp(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_POWER_CTL, BITM_ADXL363_WAKE_UP,
+                     (bEnable == true) ? BITM_ADXL363_WAKE_UP : 0u);
+}
+
+/*!
+ * @brief       Enable or disable autosleep.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enable.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_EnableAutoSleep(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_POWER_CTL, BITM_ADXL363_AUTO_SLEEP,
+                     (bEnable == true) ? BITM_ADXL363_AUTO_SLEEP : 0u);
+}
+
+/*!
+ * @brief       Select the antialiasing filter bandwidth.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eBandWidth  Filter bandwidth.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_SetFilterBandWidth(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_FILTER_BW  eBandWidth
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_FILTER_CTL, BITM_ADXL363_HALF_BW_EN,
+                     (uint8_t)eBandWidth);
+}
+
+/*!
+ * @brief       Store temperature data in the FIFO along with X/Y/Z.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enable.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_EnableTemperatureFIFO(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    uint8_t nFIFOCtl;
+    ADI_ADXL363_RESULT eResult;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    nFIFOCtl = (uint8_t)(pDev->nFIFOCtl & (uint8_t)~BITM_ADXL363_TEMP_FIFO_EN);
+    if (bEnable == true)
+    {
+        nFIFOCtl |= BITM_ADXL363_TEMP_FIFO_EN;
+    }
+    if ((eResult = WriteReg(pDev, ADI_ADXL363_FIFO_CTL, nFIFOCtl)) == ADI_ADXL363_SUCCESS)
+    {
+        pDev->nFIFOCtl = nFIFOCtl;
+    }
+    return eResult;
+}
+
+/*!
+ * @brief       Read the raw 12 bit temperature.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[out]  nPdata      Raw temperature.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         nPdata is NULL.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_GetTemperature(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    uint16_t                        *nPdata
+)
+{
+    ADI_ADXL363_RESULT eResult;
+    uint8_t aTemp[2];
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+    if (nPdata == NULL)
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+#endif
+
+    if ((eResult = ReadRegs((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_TEMP_DATA_L, aTemp, 2u)) == ADI_ADXL363_SUCCESS)
+    {
+        *nPdata = (uint16_t)((uint16_t)aTemp[1] << 8u) | (uint16_t)aTemp[0];
+    }
+    return eResult;
+}
+
+/*!
+ * @brief       Set the measurement range.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eRange      Measurement range.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_SetRange(
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_MEASUREMENT_RANGE           eRange
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_FILTER_CTL, BITM_ADXL363_RANGE,
+                     (uint8_t)eRange);
+}
+
+/*!
+ * @brief       Set the polarity of an interrupt pin.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eIntPin     Interrupt pin.
+ * @param[in]   bActiveLow  true for active low.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_SetIntPolarity (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_ADXL363_INTPIN              eIntPin,
+    bool_t                          bActiveLow
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_INT1_MAP + (uint8_t)eIntPin,
+                     BITM_ADXL363_INT_LOW, (bActiveLow == true) ? BITM_ADXL363_INT_LOW : 0u);
+}
+
+/*!
+ * @brief       Enable or disable the self test force.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   bEnable     true to enable.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_EnableSelfTest (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    bool_t                          bEnable
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return WriteReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_SELF_TEST,
+                    (bEnable == true) ? BITM_ADXL363_SELFTEST_EN : 0u);
+}
+
+/*!
+ * @brief       Configure the FIFO mode and watermark.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eFIFOMode   FIFO mode.
+ * @param[in]   nSamples    Number of samples (1-511) to store before the watermark.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_INVALID_FIFO_SAMPLES     nSamples out of range.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ *
+ * Once the FIFO is enabled adi_adxl363_Read() burst reads FIFO entries.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ConfigFIFO (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_ADXL363_FIFO_MODE           eFIFOMode,
+    uint16_t                        nSamples
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    ADI_ADXL363_RESULT eResult;
+    uint8_t nFIFOCtl;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+    if ((nSamples == 0u) || (nSamples > ADI_ADXL363_MAX_FIFO_SAMPLES))
+    {
+        return ADI_ADXL363_INVALID_FIFO_SAMPLES;
+    }
+
+    nFIFOCtl = (uint8_t)(pDev->nFIFOCtl & BITM_ADXL363_TEMP_FIFO_EN);
+    nFIFOCtl |= (uint8_t)eFIFOMode;
+    if ((nSamples & 0x100u) != 0u)
+    {
+        nFIFOCtl |= BITM_ADXL363_FIFO_HALF;
+    }
+
+    if (   ((eResult = WriteReg(pDev, ADI_ADXL363_FIFO_SAMPLES, (uint8_t)(nSamples & 0xFFu))) != ADI_ADXL363_SUCCESS)
+        || ((eResult = WriteReg(pDev, ADI_ADXL363_FIFO_CTL, nFIFOCtl)) != ADI_ADXL363_SUCCESS))
+    {
+        return eResult;
+    }
+    pDev->nFIFOCtl = nFIFOCtl;
+
+    return ADI_ADXL363_SUCCESS;
+}
+
+/*!
+ * @brief       Map interrupt sources to an interrupt pin.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eIntPin     Interrupt pin.
+ * @param[in]   nIntMap     Bitwise OR of #ADI_ADXL363_INT sources.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ *
+ * The pin polarity set by adi_adxl363_SetIntPolarity() is preserved.
+ */
+ADI_ADXL363_RESULT adi_adxl363_SetIntMap (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_ADXL363_INTPIN              eIntPin,
+    uint8_t                         nIntMap
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    return ModifyReg((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_INT1_MAP + (uint8_t)eIntPin,
+                     (uint8_t)~BITM_ADXL363_INT_LOW, nIntMap);
+}
+
+/*!
+ * @brief       Soft reset the ADXL363. All registers return to their
+ *              power-on defaults and the device enters standby.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ResetDevice(
+    ADI_ADXL363_HANDLE  const           hDevice
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+    ADI_ADXL363_RESULT eResult;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    if ((eResult = WriteReg(pDev, ADI_ADXL363_SRESET, ADI_ADXL363_SOFT_RESET_KEY)) == ADI_ADXL363_SUCCESS)
+    {
+        pDev->nFIFOCtl = 0u;
+        pDev->eState   = (uint8_t)ADI_ADXL363_STATE_STANDBY;
+    }
+    return eResult;
+}
+
+/*!
+ * @brief       Get the interrupt sources mapped to an interrupt pin.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eIntPin     Interrupt pin.
+ * @param[out]  pnIntMask   Bitwise OR of #ADI_ADXL363_INT sources.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         pnIntMask is NULL.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_GetIntMap (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    ADI_ADXL363_INTPIN              eIntPin,
+    uint8_t * const                 pnIntMask
+)
+{
+    ADI_ADXL363_RESULT eResult;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+    if (pnIntMask == NULL)
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+#endif
+
+    if ((eResult = ReadRegs((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_INT1_MAP + (uint8_t)eIntPin,
+                            pnIntMask, 1u)) == ADI_ADXL363_SUCCESS)
+    {
+        *pnIntMask &= (uint8_t)~BITM_ADXL363_INT_LOW;
+    }
+    return eResult;
+}
+
+/*!
+ * @brief       Read the STATUS register to find the interrupt source(s).
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[out]  pnIntSource Bitwise OR of #ADI_ADXL363_INT sources.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         pnIntSource is NULL.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_GetIntStatus (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    uint8_t    *const               pnIntSource
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+    if (pnIntSource == NULL)
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+#endif
+
+    return ReadRegs((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_STATUS, pnIntSource, 1u);
+}
+
+/*!
+ * @brief       Get the number of valid entries in the FIFO.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[out]  pnEntries   Number of 16 bit FIFO entries.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         pnEntries is NULL.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ */
+ADI_ADXL363_RESULT adi_adxl363_GetEntriesInFIFO (
+    ADI_ADXL363_HANDLE  const       hDevice,
+    uint16_t * const                pnEntries
+)
+{
+    ADI_ADXL363_RESULT eResult;
+    uint8_t aEntries[2];
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+    if (pnEntries == NULL)
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+#endif
+
+    if ((eResult = ReadRegs((ADI_ADXL363_DEV_DATA *)hDevice, ADI_ADXL363_FIFO_ENTRIES_L, aEntries, 2u)) == ADI_ADXL363_SUCCESS)
+    {
+        *pnEntries = (uint16_t)(((uint16_t)aEntries[1] << 8u) | (uint16_t)aEntries[0]) & BITM_ADXL363_FIFO_ENTRIES;
+    }
+    return eResult;
+}
+
+/*!
+ * @brief       Route an ADXL363 interrupt pin to a GPIO interrupt.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   eIrq        GPIO group interrupt (SYS_GPIO_INTA_IRQn/SYS_GPIO_INTB_IRQn)
+ *                          or external interrupt the pin is wired to.
+ * @param[in]   eIntPin     ADXL363 interrupt pin.
+ * @param[in]   eGPIOPort   GPIO port of the processor pin.
+ * @param[in]   nGPIOPin    GPIO pin of the processor pin.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_GPIO_FAILED              GPIO service call failed.
+ *
+ * The application callback is called with #ADI_ADXL363_EVENT_INT1 or
+ * #ADI_ADXL363_EVENT_INT2 when the pin fires.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ConfigIntPin (
+    ADI_ADXL363_HANDLE  const           hDevice,
+    IRQn_Type                           eIrq,
+    ADI_ADXL363_INTPIN                  eIntPin,
+    ADI_GPIO_PORT                       eGPIOPort,
+    ADI_GPIO_DATA                       nGPIOPin
+)
+{
+    ADI_ADXL363_DEV_DATA *pDev = (ADI_ADXL363_DEV_DATA *)hDevice;
+
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+#endif
+
+    if (   (adi_gpio_InputEnable(eGPIOPort, nGPIOPin, true) != ADI_GPIO_SUCCESS)
+        || (adi_gpio_SetGroupInterruptPins(eGPIOPort, eIrq, nGPIOPin) != ADI_GPIO_SUCCESS)
+        || (adi_gpio_RegisterCallback(eIrq, GPIOCallback, pDev) != ADI_GPIO_SUCCESS))
+    {
+        return ADI_ADXL363_GPIO_FAILED;
+    }
+    pDev->aIntIrq[eIntPin] = (uint8_t)eIrq;
+
+    return ADI_ADXL363_SUCCESS;
+}
+
+/*!
+ * @brief       Read one or more consecutive registers.
+ *
+ * @param[in]   hDevice     Device handle obtained from adi_adxl363_Open().
+ * @param[in]   nAddress    First register address.
+ * @param[out]  pData       Buffer for the register values.
+ * @param[in]   nSize       Number of registers to read.
+ *
+ * @return      Status
+ *              - #ADI_ADXL363_SUCCESS                  Call completed successfully.
+ *              - #ADI_ADXL363_INVALID_HANDLE [D]       Invalid device handle.
+ *              - #ADI_ADXL363_NULL_POINTER [D]         pData is NULL.
+ *              - #ADI_ADXL363_PENDING_IO               Another transfer is in progress.
+ *              - #ADI_ADXL363_DEVICE_ACCESS_FAILED     Register access failed.
+ *
+ * The read is issued as one read-command transaction, so the address phase and
+ * the data phase need no CPU intervention.
+ */
+ADI_ADXL363_RESULT adi_adxl363_ReadRegister (
+    ADI_ADXL363_HANDLE  const           hDevice,
+    uint32_t                            nAddress,
+    uint8_t                            *pData,
+    uint8_t                             nSize
+)
+{
+#ifdef ADI_DEBUG
+    if (ADI_ADXL363_INVALID_HANDLE(hDevice))
+    {
+        return ADI_ADXL363_INVALID_HANDLE;
+    }
+    if (pData == NULL)
+    {
+        return ADI_ADXL363_NULL_POINTER;
+    }
+#endif
+
+    return ReadRegs((ADI_ADXL363_DEV_DATA *)hDevice, (uint8_t)nAddress, pData, nSize);
+}
+
+/*@}*/
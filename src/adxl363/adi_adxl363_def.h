@@ -0,0 +1,74 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_adxl363_def.h
+ * @brief:   ADXL363 driver private definitions
+ *-----------------------------------------------------------------------------
+ *****************************************************************************/
+
+#ifndef _ADI_ADXL363_DEF_H_
+#define _ADI_ADXL363_DEF_H_
+
+/*! \cond PRIVATE */
+
+/* Number of ADXL363 instances supported by the driver */
+#define ADI_ADXL363_NUM_INSTANCES       1u
+
+/* SPI instruction set */
+#define ADI_ADXL363_CMD_WRITE_REG       0x0Au   /* write register(s) */
+#define ADI_ADXL363_CMD_READ_REG        0x0Bu   /* read register(s) */
+#define ADI_ADXL363_CMD_READ_FIFO       0x0Du   /* read FIFO, no address phase */
+
+/* Value written to SRESET to perform a soft reset */
+#define ADI_ADXL363_SOFT_RESET_KEY      0x52u
+
+/* Measurement mode field of POWER_CTL */
+#define ADI_ADXL363_MEASURE_STANDBY     0x00u
+#define ADI_ADXL363_MEASURE_ON          0x02u
+
+/* Bit 8 of the FIFO sample count lives in FIFO_CTL (AH bit) */
+#define ADI_ADXL363_MAX_FIFO_SAMPLES    511u
+
+/* Valid range of the 11 bit activity/inactivity thresholds */
+#define ADI_ADXL363_MAX_THRESHOLD       0x7FFu
+
+/* Number of valid bits of FIFO_ENTRIES */
+#define BITM_ADXL363_FIFO_ENTRIES       0x3FFu
+
+/* Bytes in the command staging buffer (instruction, address, data) */
+#define ADI_ADXL363_CMD_BUFFER_SIZE     4u
+
+/* IRQ number marking an interrupt pin as unused */
+#define ADI_ADXL363_IRQ_NONE            0xFFu
+
+/*!
+ *****************************************************************************
+ * \enum ADI_ADXL363_STATE
+ *
+ * ADXL363 driver state.
+ *
+ *****************************************************************************/
+typedef enum
+{
+    ADI_ADXL363_STATE_NOT_OPENED = 0,      /*!< Device is not opened.            */
+    ADI_ADXL363_STATE_STANDBY,             /*!< Device is opened, not measuring. */
+    ADI_ADXL363_STATE_MEASURING            /*!< Device is measuring.             */
+} ADI_ADXL363_STATE;
+
+/*! \struct ADI_ADXL363_DEV_DATA
+ *  ADXL363 device instance data. Must fit in #ADI_ADXL363_MEMORY_SIZE.
+ */
+typedef struct __ADI_ADXL363_DEV_DATA
+{
+    ADI_SPI_HANDLE          hSPIDevice;     /*!< SPI device the ADXL363 is attached to      */
+    ADI_CALLBACK            pfCallback;     /*!< Application callback                       */
+    void                   *pCBParam;       /*!< Application callback parameter             */
+    uint8_t                 aCommand[ADI_ADXL363_CMD_BUFFER_SIZE]; /*!< SPI command staging */
+    uint8_t                 eState;         /*!< #ADI_ADXL363_STATE                         */
+    uint8_t                 nFIFOCtl;       /*!< Cached FIFO_CTL register                   */
+    uint8_t                 aIntIrq[2];     /*!< GPIO IRQ used for INT1/INT2                */
+    volatile uint8_t        bPendingIO;     /*!< SPI transaction in progress                */
+} ADI_ADXL363_DEV_DATA;
+
+/*! \endcond */
+
+#endif /* _ADI_ADXL363_DEF_H_ */
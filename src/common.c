@@ -49,13 +49,231 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifdef __ICCARM__
 /*
 * Pm064 (rule 16.1): functions with variable number of arguments shall not be used
-*   Allow printf().
+*   Allow test_Format().
 */
 #pragma diag_suppress=Pm064
 #endif /* __ICCARM__ */
 
 char_t aDebugString[150];
 
+/* Output cursor of test_VFormat(), writes stop at the end of the caller's buffer */
+typedef struct
+{
+    char_t   *pBuf;                 /* destination */
+    uint32_t  nSize;                /* destination size including the terminator */
+    uint32_t  nLen;                 /* characters produced so far */
+} FORMAT_OUT;
+
+static void FormatPut(FORMAT_OUT *pOut, char_t c)
+{
+    if ((pOut->nLen + 1u) < pOut->nSize)
+    {
+        pOut->pBuf[pOut->nLen] = c;
+    }
+    pOut->nLen++;
+}
+
+static void FormatPad(FORMAT_OUT *pOut, char_t c, uint32_t nCount)
+{
+    while (nCount-- > 0u)
+    {
+        FormatPut(pOut, c);
+    }
+}
+
+/*
+ * Unsigned value in base 10 or 16, nDecimals > 0 places a decimal point
+ * that many digits from the right (fixed point).
+ */
+static void FormatNumber(FORMAT_OUT *pOut, uint32_t nValue, bool_t bNegative, uint32_t nBase,
+                         bool_t bUpper, uint32_t nWidth, bool_t bZeroPad, uint32_t nDecimals)
+{
+    char_t   digits[12];
+    uint32_t nDigits = 0u;
+    uint32_t nTotal;
+    char_t   a = bUpper ? 'A' : 'a';
+
+    /* %.Nk takes N from the format, keep the zero filled digits inside digits[] */
+    if (nDecimals > (sizeof(digits) - 2u))
+    {
+        nDecimals = sizeof(digits) - 2u;
+    }
+
+    do
+    {
+        uint32_t d = nValue % nBase;
+        digits[nDigits++] = (d < 10u) ? (char_t)('0' + d) : (char_t)(a + (d - 10u));
+        nValue /= nBase;
+    } while ((nValue != 0u) || (nDigits <= nDecimals));
+
+    nTotal = nDigits + ((nDecimals > 0u) ? 1u : 0u) + (bNegative ? 1u : 0u);
+
+    if (!bZeroPad && (nWidth > nTotal))
+    {
+        FormatPad(pOut, ' ', nWidth - nTotal);
+    }
+    if (bNegative)
+    {
+        FormatPut(pOut, '-');
+    }
+    if (bZeroPad && (nWidth > nTotal))
+    {
+        FormatPad(pOut, '0', nWidth - nTotal);
+    }
+    while (nDigits > 0u)
+    {
+        if (nDigits == nDecimals)
+        {
+            FormatPut(pOut, '.');
+        }
+        FormatPut(pOut, digits[--nDigits]);
+    }
+}
+
+/**
+ * Format into a bounded buffer
+ *
+ * @param  pBuf     destination, always terminated when nSize > 0
+ * @param  nSize    size of the destination in bytes
+ * @param  pFormat  format, supports %d %i %u %x %X %c %s %% with an optional
+ *                  '0' flag, width and 'l'/'h' (ignored, arguments are 32 bit),
+ *                  and %.Nk for a fixed point int32_t with N decimals
+ *                  (%.1k of 253 prints 25.3)
+ * @param  args     arguments
+ * @return number of characters the full output needs, excluding the terminator
+ *
+ * @brief  Small reentrant replacement for vsnprintf() without floating point
+ */
+int32_t test_VFormat(char_t *pBuf, uint32_t nSize, const char_t *pFormat, va_list args)
+{
+    FORMAT_OUT out;
+
+    out.pBuf  = pBuf;
+    out.nSize = nSize;
+    out.nLen  = 0u;
+
+    while (*pFormat != '\0')
+    {
+        bool_t   bZeroPad = false;
+        uint32_t nWidth = 0u;
+        uint32_t nPrecision = 0u;
+        bool_t   bPrecision = false;
+
+        if (*pFormat != '%')
+        {
+            FormatPut(&out, *pFormat++);
+            continue;
+        }
+        pFormat++;
+
+        if (*pFormat == '0')
+        {
+            bZeroPad = true;
+            pFormat++;
+        }
+        while ((*pFormat >= '0') && (*pFormat <= '9'))
+        {
+            nWidth = (nWidth * 10u) + (uint32_t)(*pFormat++ - '0');
+        }
+        if (*pFormat == '.')
+        {
+            bPrecision = true;
+            pFormat++;
+            while ((*pFormat >= '0') && (*pFormat <= '9'))
+            {
+                nPrecision = (nPrecision * 10u) + (uint32_t)(*pFormat++ - '0');
+            }
+        }
+        while ((*pFormat == 'l') || (*pFormat == 'h'))
+        {
+            pFormat++;
+        }
+
+        switch (*pFormat)
+        {
+        case 'd':
+        case 'i':
+        case 'k':
+        {
+            int32_t  nValue = va_arg(args, int32_t);
+            uint32_t nMagnitude = (nValue < 0) ? (0u - (uint32_t)nValue) : (uint32_t)nValue;
+            FormatNumber(&out, nMagnitude, (nValue < 0), 10u, false, nWidth, bZeroPad,
+                         (*pFormat == 'k') ? nPrecision : 0u);
+            break;
+        }
+        case 'u':
+            FormatNumber(&out, va_arg(args, uint32_t), false, 10u, false, nWidth, bZeroPad, 0u);
+            break;
+        case 'x':
+        case 'X':
+            FormatNumber(&out, va_arg(args, uint32_t), false, 16u, (*pFormat == 'X'), nWidth, bZeroPad, 0u);
+            break;
+        case 'c':
+            FormatPut(&out, (char_t)va_arg(args, int));
+            break;
+        case 's':
+        {
+            const char_t *pStr = va_arg(args, const char_t *);
+            uint32_t nLen = 0u;
+            if (pStr == NULL)
+            {
+                pStr = "(null)";
+            }
+            while ((pStr[nLen] != '\0') && (!bPrecision || (nLen < nPrecision)))
+            {
+                nLen++;
+            }
+            if (nWidth > nLen)
+            {
+                FormatPad(&out, ' ', nWidth - nLen);
+            }
+            while (nLen-- > 0u)
+            {
+                FormatPut(&out, *pStr++);
+            }
+            break;
+        }
+        case '\0':
+            /* lone % at the end */
+            pFormat--;
+            break;
+        default:
+            /* %% and unsupported conversions are copied */
+            FormatPut(&out, *pFormat);
+            break;
+        }
+        pFormat++;
+    }
+
+    if (nSize > 0u)
+    {
+        pBuf[(out.nLen < nSize) ? out.nLen : (nSize - 1u)] = '\0';
+    }
+    return (int32_t)out.nLen;
+}
+
+/**
+ * Format into a bounded buffer
+ *
+ * @param  pBuf     destination, always terminated when nSize > 0
+ * @param  nSize    size of the destination in bytes
+ * @param  pFormat  format, see test_VFormat()
+ * @return number of characters the full output needs, excluding the terminator
+ *
+ * @brief  Small reentrant replacement for snprintf() without floating point
+ */
+int32_t test_Format(char_t *pBuf, uint32_t nSize, const char_t *pFormat, ...)
+{
+    va_list args;
+    int32_t nLen;
+
+    va_start(args, pFormat);
+    nLen = test_VFormat(pBuf, nSize, pFormat, args);
+    va_end(args);
+
+    return nLen;
+}
+
 #ifdef REDIRECT_OUTPUT_TO_UART
 
 ADI_UART_HANDLE hDevOutput = NULL;
@@ -83,17 +301,17 @@ void test_Init(void)
     ADI_WDT_HANDLE hWDTDevice=NULL;    
     
     if (adi_wdt_Open(ADI_WDT_DEVID_0, &WdtMemory, sizeof WdtMemory, &hWDTDevice)) {
-        printf("adi_wdt_Open failed\n");
+        fputs("adi_wdt_Open failed\n", stdout);
     }
 
     if( adi_wdt_Enable(hWDTDevice, false) != ADI_WDT_SUCCESS )
     {
-        printf("adi_wdt_Enable failed\n");
+        fputs("adi_wdt_Enable failed\n", stdout);
     }
 
     if( adi_wdt_Close(hWDTDevice) != ADI_WDT_SUCCESS)
     {
-        printf("adi_wdt_Close failed\n");
+        fputs("adi_wdt_Close failed\n", stdout);
     }
 #ifdef REDIRECT_OUTPUT_TO_UART
     /* Set the pinmux for the UART */
@@ -119,7 +337,7 @@ void test_Pass(void)
     /* ignore return codes since there's nothing we can do if it fails */
     adi_uart_Write(hDevOutput, pass, strlen(pass));
 #else
-    printf(pass);
+    fputs(pass, stdout);
 #endif
 }
 /**
@@ -141,9 +359,9 @@ void test_Fail(char *FailureReason)
     adi_uart_Write(hDevOutput, FailureReason, strlen(FailureReason));
     adi_uart_Write(hDevOutput, term, strlen(term));
 #else
-    printf(fail);
-    printf(FailureReason);
-    printf(term);
+    fputs(fail, stdout);
+    fputs(FailureReason, stdout);
+    fputs(term, stdout);
 #endif
  }
 
@@ -165,8 +383,8 @@ void test_Perf(char *InfoString)
     adi_uart_Write(hDevOutput, InfoString, strlen(InfoString));
     adi_uart_Write(hDevOutput, term, strlen(term));
 #else
-    printf(InfoString);
-    printf(term);
+    fputs(InfoString, stdout);
+    fputs(term, stdout);
 #endif
 
     /* do not quit... */
@@ -1370,6 +1370,7 @@ static void SetupDevice (DMA_CHANNEL* pChannel)
 }
 
 /* DMA Interrupt Handler */
+ADI_ISRAM_CODE
 static void DMAInterruptHandler(DMA_CHANNEL* pChannel)
 {
     bool_t bNewFromPending = false;
@@ -1380,6 +1381,9 @@ static void DMAInterruptHandler(DMA_CHANNEL* pChannel)
 
     uint32_t nChannelBit = 1ul << DMA_CHN_NUM(pChannel->ChannelID);
 
+    ADI_TRACE(ADI_TRACE_DMA_DONE, DMA_CHN_NUM(pChannel->ChannelID));
+    ADI_STATS_INC(Dma[DMA_CHN_NUM(pChannel->ChannelID)].nDone);
+
     /* Increment the number of free discriptors */
     pChannel->nNumFreeDesc++;
 
@@ -1501,6 +1505,7 @@ ADI_INT_HANDLER (DMA_Err_Int_Handler)
                 {
                     DMA_CHANNEL* pChannel = pDMA_DevData->ChnHandles[x];
 
+                    ADI_STATS_INC(Dma[x].nErrors);
                     if (pChannel->pfCallback)
                     {
                         uint32_t nEvent = ((nErrChnClr & ((uint32_t)1u << x)) != 0u)
@@ -1549,12 +1554,14 @@ ADI_INT_HANDLER (DMA_SPORT0B_Int_Handler)
    DMAInterruptHandler(pDMA_DevData->ChnHandles[(uint32_t)SPORT0B_CHANn]); 
    ISR_EPILOG();       
 }
+ADI_ISRAM_CODE
 ADI_INT_HANDLER (DMA_SPI0_TX_Int_Handler)  
 { 
    ISR_PROLOG();     
    DMAInterruptHandler(pDMA_DevData->ChnHandles[(uint32_t)SPI0_TX_CHANn]); 
    ISR_EPILOG();       
 }
+ADI_ISRAM_CODE
 ADI_INT_HANDLER (DMA_SPI0_RX_Int_Handler)  
 {
    ISR_PROLOG();  
@@ -1573,12 +1580,14 @@ ADI_INT_HANDLER (DMA_SPI1_RX_Int_Handler)
    DMAInterruptHandler(pDMA_DevData->ChnHandles[(uint32_t)SPI1_RX_CHANn]); 
    ISR_EPILOG();       
 }
+ADI_ISRAM_CODE
 ADI_INT_HANDLER (DMA_UART_TX_Int_Handler)  
 { 
    ISR_PROLOG(); 
    DMAInterruptHandler(pDMA_DevData->ChnHandles[(uint32_t)UART_TX_CHANn]); 
    ISR_EPILOG();       
 }
+ADI_ISRAM_CODE
 ADI_INT_HANDLER (DMA_UART_RX_Int_Handler)  
 { 
    ISR_PROLOG(); 
@@ -1597,6 +1606,7 @@ ADI_INT_HANDLER (DMA_I2C0_SRX_Int_Handler)
    DMAInterruptHandler(pDMA_DevData->ChnHandles[(uint32_t)I2CS_RX_CHANn]); 
    ISR_EPILOG();       
 }
+ADI_ISRAM_CODE
 ADI_INT_HANDLER (DMA_I2C0_MX_Int_Handler)  
 { 
    ISR_PROLOG(); 
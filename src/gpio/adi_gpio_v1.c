@@ -56,6 +56,7 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 
 #include <ssdd_common/common_def.h>
+#include <services/latency/adi_latency.h>
 #include <services/gpio/adi_gpio.h>
 #include "adi_gpio_def_v1.h"
 
@@ -1687,6 +1688,7 @@ static void CommonInterruptHandler(const ADI_GPIO_IRQ_INDEX index, const IRQn_Ty
         /* params list is: application-registered cbParam, interrupt ID, and NULL */
         if(pCallbackInfo->pfCallback)
         {
+            ADI_LATENCY_IRQ_CALLBACK((uint32_t)index);
             /* TODO: Check if we need to pass interrupt status also here */
             pCallbackInfo->pfCallback (pCallbackInfo->pCBParam, (uint32_t) eIrq, NULL);
         }
@@ -1715,6 +1717,7 @@ static void CommonInterruptHandler(const ADI_GPIO_IRQ_INDEX index, const IRQn_Ty
             /* params list is: application-registered cbParam, Port number, and interrupt status */
             if((pCallbackInfo->pfCallback != NULL) && (Pins != 0u))
             {
+                ADI_LATENCY_IRQ_CALLBACK((uint32_t)index);
                 pCallbackInfo->pfCallback (pCallbackInfo->pCBParam, (uint32_t)Port,&Pins);
             }
             else
@@ -1729,6 +1732,7 @@ static void CommonInterruptHandler(const ADI_GPIO_IRQ_INDEX index, const IRQn_Ty
 /* strongly-bound interrupt handlers to override the default weak bindings */
 ADI_INT_HANDLER(Ext_Int0_Handler)
 {
+    ADI_LATENCY_IRQ_ENTRY(ADI_LATENCY_IRQ_EXT0);
     ISR_PROLOG();
     CommonInterruptHandler(ADI_GPIO_IRQ_EXT0_INDEX, XINT_EVT0_IRQn);
     ISR_EPILOG();      
@@ -1736,6 +1740,7 @@ ADI_INT_HANDLER(Ext_Int0_Handler)
 
 ADI_INT_HANDLER(Ext_Int1_Handler)
 {
+    ADI_LATENCY_IRQ_ENTRY(ADI_LATENCY_IRQ_EXT1);
     ISR_PROLOG();
     CommonInterruptHandler(ADI_GPIO_IRQ_EXT1_INDEX, XINT_EVT1_IRQn);
     ISR_EPILOG();    
@@ -1743,6 +1748,7 @@ ADI_INT_HANDLER(Ext_Int1_Handler)
 
 ADI_INT_HANDLER(Ext_Int2_Handler)
 {
+    ADI_LATENCY_IRQ_ENTRY(ADI_LATENCY_IRQ_EXT2);
     ISR_PROLOG();
     CommonInterruptHandler(ADI_GPIO_IRQ_EXT2_INDEX, XINT_EVT2_IRQn);
     ISR_EPILOG();    
@@ -1751,6 +1757,7 @@ ADI_INT_HANDLER(Ext_Int2_Handler)
 
 ADI_INT_HANDLER(Ext_Int3_Handler)
 {
+    ADI_LATENCY_IRQ_ENTRY(ADI_LATENCY_IRQ_EXT3);
     ISR_PROLOG();
 
 
@@ -1764,6 +1771,7 @@ ADI_INT_HANDLER(Ext_Int3_Handler)
      }
      if(pCallbackInfo->pfCallback)
     {
+        ADI_LATENCY_IRQ_CALLBACK(ADI_LATENCY_IRQ_EXT3);
         pCallbackInfo->pfCallback (pCallbackInfo->pCBParam, (uint32_t)nEvent, NULL);
     }
      pADI_XINT0->CLR |= (nEventFlag | BITM_XINT_CLR_IRQ3);
@@ -1774,6 +1782,7 @@ ADI_INT_HANDLER(Ext_Int3_Handler)
 
 ADI_INT_HANDLER(GPIO_A_Int_Handler)
 {
+    ADI_LATENCY_IRQ_ENTRY(ADI_LATENCY_IRQ_GROUPA);
     ISR_PROLOG();
     CommonInterruptHandler(ADI_GPIO_IRQ_GROUPA_INDEX,SYS_GPIO_INTA_IRQn);
     ISR_EPILOG();    
@@ -1782,6 +1791,7 @@ ADI_INT_HANDLER(GPIO_A_Int_Handler)
 
 ADI_INT_HANDLER(GPIO_B_Int_Handler)
 {
+    ADI_LATENCY_IRQ_ENTRY(ADI_LATENCY_IRQ_GROUPB);
     ISR_PROLOG();
     CommonInterruptHandler(ADI_GPIO_IRQ_GROUPB_INDEX,SYS_GPIO_INTB_IRQn);
     ISR_EPILOG();    
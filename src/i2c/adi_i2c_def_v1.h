@@ -65,6 +65,15 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #define NUM_I2C_BUFFERS      (2)
 
+/*
+ * Internal buffers used to describe the write and read phases of the
+ * current transaction list operation (adi_i2c_WriteRead and
+ * adi_i2c_SubmitTransactionList). A list only runs while no other
+ * buffer is queued, so the buffer lists are not used.
+ */
+#define REG_XFER_TX_BUFFER   (0)
+#define REG_XFER_RX_BUFFER   (1)
+
 /*
  * The blocking mode is set depending on the specific API's called
  * by the application.
@@ -132,6 +141,8 @@ typedef ADI_I2C_RESULT(*ManageFIFO)(struct _ADI_I2C_DRIVER_STRUCT const *drv, bo
 typedef struct _ADI_I2C_DATA_STRUCT{
         bool_t                bDeviceEnabled;       /* Boolean flag to determine whether the
                                                        device is enabled or not */
+        bool_t                bRegTransfer;         /* Boolean flag to determine whether a transaction
+                                                       list is in progress */
 	ADI_I2C_CONFIG_STRUCT config;               /* Pointer to the configuration structure */
 
 	ADI_I2C_BUFFER_STRUCT *activeBuffer;        /* Pointer to active buffer */
@@ -155,6 +166,10 @@ typedef struct _ADI_I2C_DATA_STRUCT{
     ManageFIFO             pfManageFIFO;        /* Manage FIFO function */
 
 	ADI_I2C_BUFFER_STRUCT  Buffers[NUM_I2C_BUFFERS];  /* Internal buffers */
+
+	ADI_I2C_TRANSACTION const *pXferList;       /* Current transaction list operation */
+	uint16_t               nXferCount;          /* Number of operations in the transaction list */
+	uint16_t               nXferRemaining;      /* Number of operations not yet completed */
 } ADI_I2C_DATA_STRUCT;
 
 /*
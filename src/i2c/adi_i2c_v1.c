@@ -183,6 +183,9 @@ static ADI_I2C_RESULT PioManageFIFO(ADI_I2C_DRIVER const *drv, bool_t bStart);
 /* Un Initialize the DMA */
 static void UnInitDma(ADI_I2C_DRIVER const *drv);
 
+/* Open the DMA channel of the device */
+static ADI_I2C_RESULT InitDma(ADI_I2C_DRIVER const *drv);
+
 /* Process the FIFO for DMA mode */
 static ADI_I2C_RESULT DMAManageFIFO(ADI_I2C_DRIVER const *drv, bool_t bStart);
 #endif
@@ -225,7 +228,7 @@ static ADI_I2C_BUFFER_STRUCT* fpop_buffer(ADI_I2C_BUFFER_STRUCT** pList);
 
 #if (ADI_I2C_CFG_ENABLE_MASTER_SUPPORT == 1)
 /* Start the master transfer */
-static void CommenceMasterTransfer(ADI_I2C_DRIVER const *drv, uint16_t dir);
+static void CommenceMasterTransfer(ADI_I2C_DRIVER const *drv, uint16_t slaveAddr, uint16_t dir);
 
 /* Process master address NACK interrupt */
 static __INLINE void onMasterNACKADDR    (ADI_I2C_DRIVER const *drv);
@@ -244,6 +247,30 @@ static void EnableMaster (ADI_I2C_DRIVER const *drv);
 
 /* Do callback for the given info */
 static void InfoSetCallback(ADI_I2C_DRIVER const *drv, BUFF_INFO info, uint32_t event);
+
+/* Check a transaction list operation */
+static bool_t IsValidTransaction(ADI_I2C_TRANSACTION const *pXfer);
+
+/* Start processing a transaction list */
+static ADI_I2C_RESULT StartTransactionList(ADI_I2C_DRIVER *drv, ADI_I2C_TRANSACTION const *pList, uint32_t nCount, BLOCK_MODE eBlockMode);
+
+/* Start the current operation of a transaction list */
+static void CommenceTransaction(ADI_I2C_DRIVER const *drv);
+
+/* Start the read phase of the current operation */
+static void CommenceTransactionRead(ADI_I2C_DRIVER const *drv);
+
+/* Arm the receiver for the read phase of the current operation */
+static void EnableTransactionRead(ADI_I2C_DRIVER const *drv);
+
+/* Stop the device and report the completion of a transaction list */
+static void CompleteTransactionList(ADI_I2C_DRIVER *drv);
+
+/* Get the result of the last transaction list */
+static ADI_I2C_RESULT TransactionListResult(ADI_I2C_DRIVER const *drv, uint32_t *pnCompleted);
+
+/* Process master interrupts of a transaction list */
+static void DispatchTransactionInterrupt(ADI_I2C_DRIVER *drv, uint16_t status);
 #endif
 
 #if (ADI_I2C_CFG_ENABLE_SLAVE_SUPPORT == 1)
@@ -1139,6 +1166,244 @@ ADI_I2C_RESULT adi_i2c_Read(
 
 
 
+#if (ADI_I2C_CFG_ENABLE_MASTER_SUPPORT == 1)
+/**
+ * @brief       Write then read a I2C device using a repeated start (blocking).
+ *
+ * The address, write, repeated start and read phases are executed as a single
+ * driver managed operation: the interrupt handler moves the data and issues the
+ * repeated start, and the caller is released once on the final STOP. Unlike the
+ * adi_i2c_SubmitTxBuffer()/adi_i2c_SubmitRxBuffer()/adi_i2c_Enable() sequence no
+ * buffer lists are walked, so this is the preferred way to access the registers
+ * of a slave device.
+ *
+ * Either phase may be skipped by passing a size of 0, in which case a plain write
+ * or read is performed. The transfer is always done in PIO mode.
+ *
+ * @param [in]  hDevice             The handle to the I2C master device.
+ * @param [in]  pTxBuffer           The buffer that contains the data to transmit (e.g. the register address).
+ * @param [in]  nTxSize             The number of bytes to write (65535 bytes maximum).
+ * @param [out] pRxBuffer           The data buffer that will contain the received data.
+ * @param [in]  nRxSize             The number of bytes to read (256 bytes maximum).
+ *
+ * @return      Status
+ *              - #ADI_I2C_SUCCESS                  Successfully completed the transfer.
+ *              - #ADI_I2C_INVALID_PARAMETER        Both sizes are 0, a size is too large or
+ *                                                  a buffer pointer is NULL.
+ *              - #ADI_I2C_BLOCKING_MODE_INVALID    Another transfer is in progress.
+ *              - #ADI_I2C_PARTIAL_BUFFER           The transfer completed before all the data was moved.
+ *              - #ADI_I2C_NACK_ADDR                Address NACK occurred during the transfer.
+ *              - #ADI_I2C_NACK_DATA                Data NACK occurred during the transfer.
+ *              - #ADI_I2C_ARBITRATION_LOST         Arbitration is lost during the transfer.
+ *              - #ADI_I2C_BAD_DEVICE_HANDLE  [D]   The device handle is invalid.
+ *              - #ADI_I2C_DEVICE_NOT_OPEN    [D]   The device is not open.
+ *              - #ADI_I2C_MODE_NOT_SUPPORTED [D]   The device is not a master.
+ *
+ * @sa          adi_i2c_SubmitTransactionList()
+ */
+ADI_I2C_RESULT adi_i2c_WriteRead(
+    ADI_I2C_HANDLE         const hDevice,
+    void                        *pTxBuffer,
+    uint32_t               const nTxSize,
+    void                        *pRxBuffer,
+    uint32_t               const nRxSize
+    )
+{
+    ADI_I2C_DRIVER *drv = (ADI_I2C_DRIVER *)hDevice;
+    ADI_I2C_TRANSACTION     Transaction;
+    ADI_I2C_RESULT          result;
+
+#if defined(ADI_DEBUG)
+    if (!IsDeviceHandle(drv))
+    {
+        return ADI_I2C_BAD_DEVICE_HANDLE;
+    }
+
+    if (drv->pData == NULL)
+    {
+        return ADI_I2C_DEVICE_NOT_OPEN;
+    }
+
+    if (CFG->mode != ADI_I2C_MASTER)
+    {
+        return ADI_I2C_MODE_NOT_SUPPORTED;
+    }
+#endif
+
+    if ((nTxSize > 0xFFFFu) || (nRxSize > 0xFFFFu)) {
+        return ADI_I2C_INVALID_PARAMETER;
+    }
+
+    /* Describe the transfer as a single operation list */
+    Transaction.pTxBuffer  = pTxBuffer;
+    Transaction.pRxBuffer  = pRxBuffer;
+    Transaction.nSlaveAddr = CFG->slaveAddr;
+    Transaction.nTxSize    = (uint16_t)nTxSize;
+    Transaction.nRxSize    = (uint16_t)nRxSize;
+    Transaction.bRestart   = true;
+
+    if (!IsValidTransaction(&Transaction)) {
+        return ADI_I2C_INVALID_PARAMETER;
+    }
+
+    if (drv->pData->eBlockMode != BLOCK_MODE_NONE) {
+        return ADI_I2C_BLOCKING_MODE_INVALID;
+    }
+
+    result = StartTransactionList(drv, &Transaction, 1u, BLOCK_MODE_BLOCKING);
+    if (result != ADI_I2C_SUCCESS) {
+        return result;
+    }
+
+    /* Pend for the semaphore */
+    PEND_EVENT(DATA,ADI_I2C_ERR_RTOS);
+
+    result = TransactionListResult(drv, NULL);
+
+    DATA->nXferCount = 0u;
+    drv->pData->eBlockMode = BLOCK_MODE_NONE;
+
+    return result;
+}
+
+/**
+ * @brief       Submit a list of transactions to a I2C bus (non-blocking).
+ *
+ * Each operation of the list addresses its own slave and consists of an optional
+ * write phase followed by an optional read phase, joined either by a repeated
+ * start or by a STOP/START. The whole list is walked from the interrupt handler
+ * without any application involvement between the operations, so a complete
+ * multi-sensor poll can be issued as one submission.
+ *
+ * Completion is reported once, at the end of the list or at the first operation
+ * that fails. If a callback is registered it is called with
+ * #ADI_I2C_EVENT_LIST_PROCESSED and the #ADI_I2C_RESULT of the list as argument,
+ * otherwise adi_i2c_GetTransactionListResult() waits for the completion.
+ *
+ * The list and the buffers it points to are owned by the driver until the list
+ * completes. When the DMA is enabled (adi_i2c_EnableDMA) the read phases are
+ * moved by the DMA, everything else is done from the interrupt handler.
+ *
+ * @param [in]  hDevice             The handle to the I2C master device.
+ * @param [in]  pList               The list of operations.
+ * @param [in]  nCount              The number of operations in the list (65535 maximum).
+ *
+ * @return      Status
+ *              - #ADI_I2C_SUCCESS                  Successfully submitted the list.
+ *              - #ADI_I2C_INVALID_PARAMETER        pList is NULL, nCount is invalid or an operation
+ *                                                  has no data, a NULL buffer or more than 256 bytes to read.
+ *              - #ADI_I2C_BLOCKING_MODE_INVALID    Another transfer is in progress.
+ *              - #ADI_I2C_BAD_DEVICE_HANDLE  [D]   The device handle is invalid.
+ *              - #ADI_I2C_DEVICE_NOT_OPEN    [D]   The device is not open.
+ *              - #ADI_I2C_MODE_NOT_SUPPORTED [D]   The device is not a master.
+ *
+ * @sa          adi_i2c_GetTransactionListResult()
+ */
+ADI_I2C_RESULT adi_i2c_SubmitTransactionList(
+    ADI_I2C_HANDLE              const hDevice,
+    ADI_I2C_TRANSACTION const * const pList,
+    uint32_t                    const nCount
+    )
+{
+    ADI_I2C_DRIVER *drv = (ADI_I2C_DRIVER *)hDevice;
+    uint32_t i;
+
+#if defined(ADI_DEBUG)
+    if (!IsDeviceHandle(drv))
+    {
+        return ADI_I2C_BAD_DEVICE_HANDLE;
+    }
+
+    if (drv->pData == NULL)
+    {
+        return ADI_I2C_DEVICE_NOT_OPEN;
+    }
+
+    if (CFG->mode != ADI_I2C_MASTER)
+    {
+        return ADI_I2C_MODE_NOT_SUPPORTED;
+    }
+#endif
+
+    if ((pList == NULL) || (nCount == 0u) || (nCount > 0xFFFFu)) {
+        return ADI_I2C_INVALID_PARAMETER;
+    }
+
+    for (i = 0u; i < nCount; i++) {
+        if (!IsValidTransaction(&pList[i])) {
+            return ADI_I2C_INVALID_PARAMETER;
+        }
+    }
+
+    if (drv->pData->eBlockMode != BLOCK_MODE_NONE) {
+        return ADI_I2C_BLOCKING_MODE_INVALID;
+    }
+
+    return StartTransactionList(drv, pList, nCount, BLOCK_MODE_NON_BLOCKING);
+}
+
+/**
+ * @brief       Wait for the completion of a transaction list and return its result.
+ *
+ * @note This API is used when no callback is registered.
+ *
+ * @param [in]  hDevice             The handle to the I2C master device.
+ * @param [out] pnCompleted         The number of operations completed successfully. Can be NULL.
+ *
+ * @return      Status
+ *              - #ADI_I2C_SUCCESS                  All the operations completed successfully.
+ *              - #ADI_I2C_BLOCKING_MODE_INVALID    No transaction list was submitted.
+ *              - #ADI_I2C_PARTIAL_BUFFER           An operation completed before all its data was moved.
+ *              - #ADI_I2C_NACK_ADDR                Address NACK occurred, the list was aborted.
+ *              - #ADI_I2C_NACK_DATA                Data NACK occurred, the list was aborted.
+ *              - #ADI_I2C_ARBITRATION_LOST         Arbitration is lost, the list was aborted.
+ *              - #ADI_I2C_BAD_DEVICE_HANDLE  [D]   The device handle is invalid.
+ *              - #ADI_I2C_DEVICE_NOT_OPEN    [D]   The device is not open.
+ *              - #ADI_I2C_MODE_NOT_SUPPORTED [D]   A callback function is registered.
+ *
+ * @sa          adi_i2c_SubmitTransactionList()
+ */
+ADI_I2C_RESULT adi_i2c_GetTransactionListResult(
+    ADI_I2C_HANDLE         const hDevice,
+    uint32_t             * const pnCompleted
+    )
+{
+    ADI_I2C_DRIVER *drv = (ADI_I2C_DRIVER *)hDevice;
+    ADI_I2C_RESULT result;
+
+#if defined(ADI_DEBUG)
+    if (!IsDeviceHandle(drv))
+    {
+        return ADI_I2C_BAD_DEVICE_HANDLE;
+    }
+
+    if (drv->pData == NULL)
+    {
+        return ADI_I2C_DEVICE_NOT_OPEN;
+    }
+
+    if (drv->pData->Callback != NULL)
+    {
+        return ADI_I2C_MODE_NOT_SUPPORTED;
+    }
+#endif
+
+    if ((drv->pData->eBlockMode != BLOCK_MODE_NON_BLOCKING) || (DATA->nXferCount == 0u)) {
+        return ADI_I2C_BLOCKING_MODE_INVALID;
+    }
+
+    /* Pend for the semaphore */
+    PEND_EVENT(DATA,ADI_I2C_ERR_RTOS);
+
+    result = TransactionListResult(drv, pnCompleted);
+
+    DATA->nXferCount = 0u;
+    drv->pData->eBlockMode = BLOCK_MODE_NONE;
+
+    return result;
+}
+#endif
+
 /**
  * @brief    Set the Hardware Address Width
  *
@@ -2247,10 +2512,8 @@ static void FlushRx(ADI_I2C_DRIVER const *drv)
 
 /* Start the master transfer */
 #if (ADI_I2C_CFG_ENABLE_MASTER_SUPPORT == 1)
-static void CommenceMasterTransfer(ADI_I2C_DRIVER const *drv, uint16_t dir)
+static void CommenceMasterTransfer(ADI_I2C_DRIVER const *drv, uint16_t slaveAddr, uint16_t dir)
 {
-    uint16_t slaveAddr = drv->pData->config.slaveAddr;
-
     /*
         Initiates a master-mode transfer.
         Program the master control byte with control code, chip select bits (slaveID)
@@ -2436,9 +2699,9 @@ static void DMAMasterHandler (void *pcbParam, uint32_t Event, void *pArg);
 static void DMASlaveTxHandler (void *pcbParam, uint32_t Event, void *pArg);
 static void DMASlaveRxHandler (void *pcbParam, uint32_t Event, void *pArg);
 
-/* Process the FIFO for DMA mode */
 #if (ADI_I2C_CFG_ENABLE_DMA_SUPPORT == 1)
-static ADI_I2C_RESULT DMAManageFIFO(ADI_I2C_DRIVER const *drv, bool_t bStart)
+/* Open the DMA channel of the device if it is not open yet */
+static ADI_I2C_RESULT InitDma(ADI_I2C_DRIVER const *drv)
 {
     ADI_DMA_CHANNEL_ID eChannelID;
     ADI_CALLBACK       pfCallback;
@@ -2513,6 +2776,16 @@ static ADI_I2C_RESULT DMAManageFIFO(ADI_I2C_DRIVER const *drv, bool_t bStart)
         CFG->bDmaInitialized = true;
     }
 
+    return ADI_I2C_SUCCESS;
+}
+
+/* Process the FIFO for DMA mode */
+static ADI_I2C_RESULT DMAManageFIFO(ADI_I2C_DRIVER const *drv, bool_t bStart)
+{
+    if (InitDma(drv) != ADI_I2C_SUCCESS) {
+        return ADI_I2C_DMA_ERROR;
+    }
+
     if (bStart)
     {
 #if (ADI_I2C_CFG_ENABLE_MASTER_SUPPORT == 1)
@@ -2659,7 +2932,7 @@ static ADI_I2C_RESULT InitActiveBufferTransfer(ADI_I2C_DRIVER const *drv)
         }
 
         /* Commense Master Transfer */
-        CommenceMasterTransfer(drv, (uint16_t)ABUFF->Direction);
+        CommenceMasterTransfer(drv, CFG->slaveAddr, (uint16_t)ABUFF->Direction);
 #endif
 #ifdef ADI_I2C_CFG_ENABLE_MASTER_SLAVE_SUPPORT
     }
@@ -2814,6 +3087,265 @@ static void InfoSetCallback(ADI_I2C_DRIVER const *drv, BUFF_INFO info, uint32_t
     }
 }
 
+/* Check a transaction list operation */
+static bool_t IsValidTransaction(ADI_I2C_TRANSACTION const *pXfer)
+{
+    if (   ((pXfer->nTxSize == 0u) && (pXfer->nRxSize == 0u))
+        || ((pXfer->nTxSize != 0u) && (pXfer->pTxBuffer == NULL))
+        || ((pXfer->nRxSize != 0u) && (pXfer->pRxBuffer == NULL))
+        || (pXfer->nRxSize > 256u))
+    {
+        return false;
+    }
+    return true;
+}
+
+/* Start processing a transaction list */
+static ADI_I2C_RESULT StartTransactionList(ADI_I2C_DRIVER *drv, ADI_I2C_TRANSACTION const *pList, uint32_t nCount, BLOCK_MODE eBlockMode)
+{
+    ADI_I2C_RESULT result;
+
+    /* Setup the device */
+    result = SetupDevice(drv);
+    if (result != ADI_I2C_SUCCESS) {
+        return result;
+    }
+
+    DATA->eBlockMode = eBlockMode;
+    DATA->pXferList = pList;
+    DATA->nXferCount = (uint16_t)nCount;
+    DATA->nXferRemaining = (uint16_t)nCount;
+    DATA->bRegTransfer = true;
+    DATA->bDeviceEnabled = true;
+    ADI_TRACE(ADI_TRACE_I2C_LIST_BEGIN, nCount);
+    ADI_STATS_INC(I2c.nLists);
+
+    /* Enable the master and launch the first operation */
+    EnableMaster(drv);
+    CommenceTransaction(drv);
+
+    return ADI_I2C_SUCCESS;
+}
+
+/* Start the current operation of a transaction list */
+static void CommenceTransaction(ADI_I2C_DRIVER const *drv)
+{
+    ADI_I2C_TRANSACTION const *pXfer = DATA->pXferList;
+    ADI_I2C_BUFFER_STRUCT *pTxBuff = &DATA->Buffers[REG_XFER_TX_BUFFER];
+    ADI_I2C_BUFFER_STRUCT *pRxBuff = &DATA->Buffers[REG_XFER_RX_BUFFER];
+
+    ADI_TRACE(ADI_TRACE_I2C_XFER, DATA->nXferRemaining);
+
+    /* Fill in the write and read phase details */
+    pTxBuff->pData = pXfer->pTxBuffer;
+    pTxBuff->pCurData = pXfer->pTxBuffer;
+    pTxBuff->BytesRemaining = pXfer->nTxSize;
+    pTxBuff->Info = BUFF_INFO_NONE;
+    pTxBuff->Direction = OUTBOUND;
+
+    pRxBuff->pData = pXfer->pRxBuffer;
+    pRxBuff->pCurData = pXfer->pRxBuffer;
+    pRxBuff->BytesRemaining = pXfer->nRxSize;
+    pRxBuff->Info = BUFF_INFO_NONE;
+    pRxBuff->Direction = INBOUND;
+
+    if (pTxBuff->BytesRemaining > 0u) {
+        /* Preload the Tx FIFO so the first data byte follows the address without an interrupt */
+        FlushTx(drv);
+        while (   (pTxBuff->BytesRemaining > 0u)
+               && ((BMASK(REG(STAT),BITM_I2C_STAT_MTXF) >> BITP_I2C_STAT_MTXF) < 2u)) {
+            REG(MTX) = *pTxBuff->pCurData;
+            pTxBuff->pCurData++;
+            pTxBuff->BytesRemaining--;
+        }
+
+        SET_REG_BITS(MCTL,BITM_I2C_MCTL_IENMTX | BITM_I2C_MCTL_IENCMP);
+        CommenceMasterTransfer(drv, pXfer->nSlaveAddr, (uint16_t)OUTBOUND);
+    } else {
+        CommenceTransactionRead(drv);
+    }
+}
+
+/* Start the read phase of the current operation */
+static void CommenceTransactionRead(ADI_I2C_DRIVER const *drv)
+{
+    EnableTransactionRead(drv);
+    SET_REG_BITS(MCTL,BITM_I2C_MCTL_IENCMP);
+    CommenceMasterTransfer(drv, DATA->pXferList->nSlaveAddr, (uint16_t)INBOUND);
+}
+
+/* Arm the receiver for the read phase of the current operation */
+static void EnableTransactionRead(ADI_I2C_DRIVER const *drv)
+{
+    ADI_I2C_BUFFER_STRUCT *pRxBuff = &DATA->Buffers[REG_XFER_RX_BUFFER];
+
+    REG(MRXCNT) = (uint16_t)(pRxBuff->BytesRemaining - 1u);
+
+#if (ADI_I2C_CFG_ENABLE_DMA_SUPPORT == 1)
+    /* With the DMA the received bytes go straight to the buffer, the
+       completion is still reported by the TCOMP interrupt */
+    if (CFG->bDmaEnabled && (InitDma(drv) == ADI_I2C_SUCCESS)) {
+        ADI_DMA_TRANSFER Transfer;
+
+        Transfer.DataWidth = ADI_DMA_WIDTH_1_BYTE;
+        Transfer.NumTransfers = pRxBuff->BytesRemaining;
+        Transfer.pSrcData = &REG(MRX);
+        Transfer.SrcInc = ADI_DMA_INCR_NONE;
+        Transfer.pDstData = pRxBuff->pCurData;
+        Transfer.DstInc = ADI_DMA_INCR_1_BYTE;
+
+        if (adi_dma_SubmitTransfer(DATA->hDMAHandle, &Transfer) == ADI_DMA_SUCCESS) {
+            pRxBuff->pCurData += pRxBuff->BytesRemaining;
+            pRxBuff->BytesRemaining = 0u;
+            SET_REG_BITS(MCTL,BITM_I2C_MCTL_MRXDMA);
+            return;
+        }
+    }
+#endif
+
+    /* PIO read */
+    SET_REG_BITS(MCTL,BITM_I2C_MCTL_IENMRX);
+}
+
+/* Stop the device and report the completion of a transaction list */
+static void CompleteTransactionList(ADI_I2C_DRIVER *drv)
+{
+    StopDevice(drv);
+    DATA->bDeviceEnabled = false;
+    DATA->bRegTransfer = false;
+    ADI_TRACE(ADI_TRACE_I2C_LIST_END, DATA->nXferRemaining);
+#if (ADI_CFG_ENABLE_STATS == 1)
+    if (DATA->nXferRemaining != 0u) {
+        ADI_STATS_INC(I2c.nFailedLists);
+    }
+#endif
+
+    if ((DATA->Callback != NULL) && (DATA->eBlockMode == BLOCK_MODE_NON_BLOCKING))
+    {
+        ADI_I2C_RESULT result = TransactionListResult(drv, NULL);
+
+        DATA->nXferCount = 0u;
+        DATA->eBlockMode = BLOCK_MODE_NONE;
+
+        DATA->Callback(DATA->pCallParam, (uint32_t)ADI_I2C_EVENT_LIST_PROCESSED, (void *)(uint32_t)result);
+    }
+    else
+    {
+        /* Post Semaphore */
+        POST_EVENT(DATA);
+    }
+}
+
+/* Get the result of the last transaction list */
+static ADI_I2C_RESULT TransactionListResult(ADI_I2C_DRIVER const *drv, uint32_t *pnCompleted)
+{
+    ADI_I2C_RESULT result;
+    uint16_t Info = DATA->Buffers[REG_XFER_TX_BUFFER].Info | DATA->Buffers[REG_XFER_RX_BUFFER].Info;
+
+    result = (DATA->nXferRemaining == 0u) ? ADI_I2C_SUCCESS : ADI_I2C_PARTIAL_BUFFER;
+
+    /* Determine whether any errors have occurred during the processing */
+    if ((Info & BUFF_INFO_ERR) != 0u)
+    {
+        if ((Info & BUFF_INFO_NACK_ADDR) == BUFF_INFO_NACK_ADDR) {
+            result = ADI_I2C_NACK_ADDR;
+        }
+
+        if ((Info & BUFF_INFO_NACK_DATA) == BUFF_INFO_NACK_DATA) {
+            result = ADI_I2C_NACK_DATA;
+        }
+
+        if ((Info & BUFF_INFO_NACK_ALOST) == BUFF_INFO_NACK_ALOST) {
+            result = ADI_I2C_ARBITRATION_LOST;
+        }
+    }
+
+    if (pnCompleted != NULL) {
+        *pnCompleted = (uint32_t)DATA->nXferCount - (uint32_t)DATA->nXferRemaining;
+    }
+
+    return result;
+}
+
+/* Process master interrupts of a transaction list */
+static void DispatchTransactionInterrupt(ADI_I2C_DRIVER *drv, uint16_t status)
+{
+    ADI_I2C_BUFFER_STRUCT *pTxBuff = &DATA->Buffers[REG_XFER_TX_BUFFER];
+    ADI_I2C_BUFFER_STRUCT *pRxBuff = &DATA->Buffers[REG_XFER_RX_BUFFER];
+
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_MTXREQ)) {
+        /* Keep the Tx FIFO topped up */
+        while (   (pTxBuff->BytesRemaining > 0u)
+               && ((BMASK(REG(STAT),BITM_I2C_STAT_MTXF) >> BITP_I2C_STAT_MTXF) < 2u)) {
+            REG(MTX) = *pTxBuff->pCurData;
+            pTxBuff->pCurData++;
+            pTxBuff->BytesRemaining--;
+        }
+
+        if (pTxBuff->BytesRemaining == 0u) {
+            CLR_REG_BITS(MCTL,BITM_I2C_MCTL_IENMTX);
+
+            if ((pRxBuff->BytesRemaining > 0u) && (DATA->pXferList->bRestart)) {
+                /* Rewriting the address while the write phase is still in progress
+                   issues a repeated start for the read once the Tx FIFO drains */
+                EnableTransactionRead(drv);
+                REG(ADDR1) = CFG->firstMasterAddressByte | 0x0001u;
+            }
+        }
+    }
+
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_MRXREQ)) {
+        while (   (pRxBuff->BytesRemaining > 0u)
+               && (BMASK(REG(STAT),BITM_I2C_STAT_MRXF) != 0u)) {
+            *pRxBuff->pCurData = (uint8_t)REG(MRX);
+            pRxBuff->pCurData++;
+            pRxBuff->BytesRemaining--;
+        }
+    }
+
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_ALOST)) {
+        SET_BITS_U16(pTxBuff->Info, BUFF_INFO_NACK_ALOST);
+    }
+
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_NACKADDR)) {
+        SET_BITS_U16(pTxBuff->Info, BUFF_INFO_NACK_ADDR);
+    }
+
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_NACKDATA)) {
+        SET_BITS_U16(pTxBuff->Info, BUFF_INFO_NACK_DATA);
+    }
+
+    /* STOP: move on to the next phase or operation */
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_TCOMP)) {
+        bool_t bReadStarted = IS_ANY_BITS_SET(REG(MCTL),BITM_I2C_MCTL_IENMRX | BITM_I2C_MCTL_MRXDMA);
+
+        CLR_BITS_U16(REG(MCTL),BITM_I2C_MCTL_IENCMP | BITM_I2C_MCTL_IENMRX | BITM_I2C_MCTL_IENMTX | BITM_I2C_MCTL_MRXDMA);
+
+        if ((pTxBuff->Info & BUFF_INFO_ERR) == 0u) {
+            /* Read phase after a STOP/START */
+            if ((pRxBuff->BytesRemaining > 0u) && (!bReadStarted)) {
+                CommenceTransactionRead(drv);
+                return;
+            }
+
+            if ((pTxBuff->BytesRemaining == 0u) && (pRxBuff->BytesRemaining == 0u)) {
+                DATA->nXferRemaining--;
+                ADI_STATS_INC(I2c.nTransactions);
+                ADI_STATS_ADD(I2c.nBytes, DATA->pXferList->nTxSize + DATA->pXferList->nRxSize);
+
+                if (DATA->nXferRemaining > 0u) {
+                    DATA->pXferList++;
+                    CommenceTransaction(drv);
+                    return;
+                }
+            }
+        }
+
+        /* End of the list or aborted */
+        CompleteTransactionList(drv);
+    }
+}
+
 /* Process master arbitration lost interrupt */
 static __INLINE void onMasterALOST    (ADI_I2C_DRIVER const *drv) {
     InfoSetCallback(drv, BUFF_INFO_NACK_ALOST, ADI_I2C_EVENT_LOSTARB);
@@ -2954,6 +3486,25 @@ static void DispatchMasterInterrupt (ADI_I2C_DRIVER *drv)
 {
     register uint16_t status = REG(MSTAT);
 
+    ADI_TRACE(ADI_TRACE_I2C_MSTAT, status);
+#if (ADI_CFG_ENABLE_STATS == 1)
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_NACKADDR)) {
+        ADI_STATS_INC(I2c.nNackAddr);
+    }
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_NACKDATA)) {
+        ADI_STATS_INC(I2c.nNackData);
+    }
+    if (IS_BIT_SET(status,BITM_I2C_MSTAT_ALOST)) {
+        ADI_STATS_INC(I2c.nArbLost);
+    }
+#endif
+
+    /* Transaction lists have their own state machine */
+    if (DATA->bRegTransfer) {
+        DispatchTransactionInterrupt(drv, status);
+        return;
+    }
+
     /* priortized master-mode event handlers */
     if (!CFG->bDmaEnabled) {
         if (IS_ANY_BITS_SET(status,BITM_I2C_MSTAT_MRXREQ | BITM_I2C_MSTAT_MTXREQ)) {
@@ -2990,6 +3541,11 @@ static void DMAMasterHandler (void *pcbParam, uint32_t Event, void *pArg)
 {
     ADI_I2C_DRIVER const *drv = &adi_i2c_Device[0*2 + 0];
 
+    /* Transaction list reads complete on the TCOMP interrupt */
+    if (DATA->bRegTransfer) {
+        return;
+    }
+
     IntManageBuffers(drv);
 }
 #endif
@@ -0,0 +1,198 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_latency.c
+ * @brief:   Interrupt masking and GPIO interrupt latency measurement
+ *-----------------------------------------------------------------------------
+ *
+ * The critical section state is only touched with interrupts masked, the
+ * interrupt state by the armed handler after the trigger.
+ *
+ *****************************************************************************/
+#include <string.h>
+#include <adi_processor.h>
+#include <services/latency/adi_latency.h>
+
+#if (ADI_CFG_ENABLE_LATENCY == 1)
+
+#define NO_IRQ_ARMED    (0xFFFFFFFFu)
+
+ADI_LATENCY_IRQ adi_latency_Irq[ADI_LATENCY_NUM_IRQ];
+
+static ADI_LATENCY_SITE *pSites;            /* most recent site first */
+static ADI_LATENCY_SITE *pLastSite;         /* first site seen, end of the list */
+static ADI_LATENCY_SITE *pActiveSite;       /* site of the open region */
+static uint32_t nRegionStart;               /* cycle count when it masked */
+
+static volatile uint32_t nArmedIrq = NO_IRQ_ARMED;
+static volatile uint32_t nTrigger;          /* cycle count of the trigger */
+
+static void StartCycleCounter (void)
+{
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0u)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+static uint32_t Bucket (uint32_t const nCycles)
+{
+    uint32_t nBits = 32u - __CLZ(nCycles);
+
+    if (nBits <= 5u)
+    {
+        return 0u;
+    }
+    nBits -= 5u;
+    return (nBits < ADI_LATENCY_BUCKETS) ? nBits : (ADI_LATENCY_BUCKETS - 1u);
+}
+
+static void Account (ADI_LATENCY_DIST *const pDist, uint32_t const nCycles)
+{
+    if ((pDist->nCount == 0u) || (nCycles < pDist->nMinCycles))
+    {
+        pDist->nMinCycles = nCycles;
+    }
+    if (nCycles > pDist->nMaxCycles)
+    {
+        pDist->nMaxCycles = nCycles;
+    }
+    pDist->aHistogram[Bucket(nCycles)]++;
+    pDist->nCount++;
+}
+
+/**
+ * @brief  Mask the interrupts and start timing a region, see ADI_ENTER_CRITICAL_REGION()
+ *
+ * @param [in]  pSite   Call site of the region.
+ */
+void adi_latency_CsEnter (ADI_LATENCY_SITE *const pSite)
+{
+    uint32_t nPrimask = __get_PRIMASK();
+
+    __disable_irq();
+
+    if (nPrimask == 0u)
+    {
+        StartCycleCounter();
+        pActiveSite = pSite;
+        nRegionStart = DWT->CYCCNT;
+    }
+}
+
+/**
+ * @brief  Account the open region and unmask the interrupts, see ADI_EXIT_CRITICAL_REGION()
+ */
+void adi_latency_CsExit (void)
+{
+    ADI_LATENCY_SITE *pSite = pActiveSite;
+    uint32_t nCycles;
+    uint32_t nBucket;
+
+    if (pSite != NULL)
+    {
+        nCycles = DWT->CYCCNT - nRegionStart;
+        nBucket = Bucket(nCycles);
+        pActiveSite = NULL;
+
+        if ((pSite->pNext == NULL) && (pSite != pLastSite))
+        {
+            if (pSites == NULL)
+            {
+                pLastSite = pSite;
+            }
+            pSite->pNext = pSites;
+            pSites = pSite;
+        }
+        if (nCycles > pSite->nMaxCycles)
+        {
+            pSite->nMaxCycles = nCycles;
+        }
+        pSite->aHistogram[nBucket]++;
+        pSite->nCount++;
+    }
+
+    __enable_irq();
+}
+
+/**
+ * @brief  Critical section call sites seen so far
+ *
+ * @return First site, follow pNext for the others. NULL if none completed yet.
+ */
+ADI_LATENCY_SITE *adi_latency_GetSites (void)
+{
+    return pSites;
+}
+
+/**
+ * @brief  Stamp the trigger of a GPIO interrupt
+ *
+ * @param [in]  nIrq    Interrupt that the caller is about to trigger, ADI_LATENCY_IRQ_xxx.
+ *
+ * Call it just before the pin change or the NVIC pend. The interrupt is
+ * measured once, up to its callback.
+ */
+void adi_latency_Arm (uint32_t const nIrq)
+{
+    StartCycleCounter();
+    nTrigger = DWT->CYCCNT;
+    nArmedIrq = nIrq;
+}
+
+/**
+ * @brief  Measure the handler entry of an armed GPIO interrupt, see ADI_LATENCY_IRQ_ENTRY()
+ *
+ * @param [in]  nIrq    Interrupt being handled, ADI_LATENCY_IRQ_xxx.
+ */
+void adi_latency_IrqEntry (uint32_t const nIrq)
+{
+    uint32_t nCycles = DWT->CYCCNT - nTrigger;
+
+    if (nIrq == nArmedIrq)
+    {
+        Account(&adi_latency_Irq[nIrq].Entry, nCycles);
+    }
+}
+
+/**
+ * @brief  Measure the callback of an armed GPIO interrupt and disarm it, see ADI_LATENCY_IRQ_CALLBACK()
+ *
+ * @param [in]  nIrq    Interrupt being handled, ADI_LATENCY_IRQ_xxx.
+ */
+void adi_latency_IrqCallback (uint32_t const nIrq)
+{
+    uint32_t nCycles = DWT->CYCCNT - nTrigger;
+
+    if (nIrq == nArmedIrq)
+    {
+        Account(&adi_latency_Irq[nIrq].Callback, nCycles);
+        nArmedIrq = NO_IRQ_ARMED;
+    }
+}
+
+/**
+ * @brief  Clear all the measurements
+ *
+ * The call sites stay in the list with zero counts.
+ */
+void adi_latency_Reset (void)
+{
+    ADI_LATENCY_SITE *pSite;
+    uint32_t nPrimask = __get_PRIMASK();
+
+    __disable_irq();
+
+    for (pSite = pSites; pSite != NULL; pSite = pSite->pNext)
+    {
+        pSite->nCount = 0u;
+        pSite->nMaxCycles = 0u;
+        memset(pSite->aHistogram, 0, sizeof(pSite->aHistogram));
+    }
+    memset(adi_latency_Irq, 0, sizeof(adi_latency_Irq));
+    nArmedIrq = NO_IRQ_ARMED;
+
+    __set_PRIMASK(nPrimask);
+}
+
+#endif /* ADI_CFG_ENABLE_LATENCY */
@@ -1730,6 +1730,11 @@ ADI_SPI_RESULT adi_spi_MasterTransfer (ADI_SPI_HANDLE const hDevice, ADI_SPI_TRA
     }
 #endif /* ADI_DEBUG */
 
+    ADI_TRACE(ADI_TRACE_SPI_XFER, pXfr->TransmitterBytes);
+    ADI_STATS_INC(Spi[hDevice->pDevInfo - spi_device_info].nTransfers);
+    ADI_STATS_ADD(Spi[hDevice->pDevInfo - spi_device_info].nTxBytes, pXfr->TransmitterBytes);
+    ADI_STATS_ADD(Spi[hDevice->pDevInfo - spi_device_info].nRxBytes, pXfr->ReceiverBytes);
+
     /* disable interrupts during manual prologue phase */
     ADI_DISABLE_INT(hDevice->pDevInfo->eIRQn);
     hDevice->pSpi->CTL &= (uint16_t)~(BITM_SPI_CTL_TIM | BITM_SPI_CTL_RFLUSH | BITM_SPI_CTL_TFLUSH);
@@ -2209,6 +2214,15 @@ static void common_SPI_Int_Handler (ADI_SPI_DEV_DATA_TYPE* pDD)
     volatile  uint16_t nFifoStatus = pDD->pSpi->FIFO_STAT;
     uint16_t nErrorStatus = pDD->pSpi->STAT;
 
+#if (ADI_CFG_ENABLE_STATS == 1)
+    if ((BITM_SPI_STAT_RXOVR & nErrorStatus) != 0u) {
+        ADI_STATS_INC(Spi[pDD->pDevInfo - spi_device_info].nRxOverflows);
+    }
+    if ((BITM_SPI_STAT_TXUNDR & nErrorStatus) != 0u) {
+        ADI_STATS_INC(Spi[pDD->pDevInfo - spi_device_info].nTxUnderflows);
+    }
+#endif /* ADI_CFG_ENABLE_STATS */
+
 #if (ADI_SPI_CFG_INTERRUPT_MODE_SUPPORT == 1)
     uint16_t writableBytes;
     uint16_t readableBytes;
@@ -292,6 +292,9 @@ const IntVector __vector_table[] =
     
 } ;
 
+/* LENGTHOF_IVT in startup.h sizes the copies of this table, keep them in step */
+typedef char lengthof_ivt_check[((sizeof __vector_table / sizeof *__vector_table) == LENGTHOF_IVT) ? 1 : -1];
+
  #pragma location="ReadProtectedKeyHash"
 __root const uint32_t ReadProKeyHsh[] =
     { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu };        
@@ -310,9 +313,9 @@ __root const uint32_t NumOfCRCPages = 0u;
     vector patching required by RTOS.  Places the relocated IVT
     at the start of RAM.  Note: the IVT placement is required
     to be next power-of-two	of the vector table size.  So the
-    IVT includes 61	programmable interrupts, 15 system exception
+    IVT includes 64	programmable interrupts, 15 system exception
     vectors and	the main stack pointer, therefore we need
-    (61 + 15 + 1)*4	= 308 bytes, which rounds up to a 512 (0x200)
+    (64 + 15 + 1)*4	= 320 bytes, which rounds up to a 512 (0x200)
     address	boundary (which address 0x20000000 satisfies).
 
     Also note use of the "__no_init" attribute to force the
@@ -324,8 +327,6 @@ __root const uint32_t NumOfCRCPages = 0u;
 #define RELOCATION_ADDRESS   (0x20000000)
 #define RELOCATION_ALIGNMENT      (0x200)
 
-#define LENGTHOF_IVT (sizeof __vector_table / sizeof *__vector_table)
-
 #if defined ( __ICCARM__ )
     #pragma data_alignment=RELOCATION_ALIGNMENT  /* IAR */
 #elif defined (__CC_ARM)
@@ -0,0 +1,85 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_stats.c
+ * @brief:   Driver performance counters
+ *-----------------------------------------------------------------------------
+ *
+ * The interrupt handler timing costs two calls and about 30 cycles per
+ * interrupt, the driver counters a load and a store each.
+ *
+ *****************************************************************************/
+#include <string.h>
+#include <adi_processor.h>
+#include <services/stats/adi_stats.h>
+
+#if (ADI_CFG_ENABLE_STATS == 1)
+
+ADI_STATS adi_stats_Data;
+
+/**
+ * @brief  Copy all the counters and optionally clear them
+ *
+ * @param [out] pCopy   Destination of the counters.
+ * @param [in]  bReset  true to restart the counters from zero.
+ *
+ * Interrupts are masked for the copy so the block is consistent.
+ */
+void adi_stats_Snapshot (ADI_STATS *const pCopy, bool_t const bReset)
+{
+    uint32_t nPrimask = __get_PRIMASK();
+
+    __disable_irq();
+
+    memcpy(pCopy, &adi_stats_Data, sizeof(adi_stats_Data));
+    if (bReset)
+    {
+        memset(&adi_stats_Data, 0, sizeof(adi_stats_Data));
+    }
+
+    __set_PRIMASK(nPrimask);
+}
+
+/**
+ * @brief  Start timing an interrupt handler, see ISR_PROLOG()
+ *
+ * @return Cycle count at handler entry.
+ *
+ * The DWT cycle counter is started here the first time, the first call of
+ * each handler may therefore time as zero.
+ */
+uint32_t adi_stats_IsrBegin (void)
+{
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0u)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief  Account an interrupt handler call, see ISR_EPILOG()
+ *
+ * @param [in]  nStart  Cycle count returned by adi_stats_IsrBegin().
+ */
+void adi_stats_IsrEnd (uint32_t const nStart)
+{
+    uint32_t nCycles = DWT->CYCCNT - nStart;
+    uint32_t nIrq = (__get_IPSR() - 16u) & (ADI_STATS_NUM_IRQ - 1u);
+    ADI_STATS_ISR *pIsr = &adi_stats_Data.Isr[nIrq];
+
+    /* A handler is only preempted by a higher priority one, which completes
+       its own update before this one resumes */
+    if ((pIsr->nCalls == 0u) || (nCycles < pIsr->nMinCycles))
+    {
+        pIsr->nMinCycles = nCycles;
+    }
+    pIsr->nCalls++;
+    pIsr->nCycles += nCycles;
+    if (nCycles > pIsr->nMaxCycles)
+    {
+        pIsr->nMaxCycles = nCycles;
+    }
+}
+
+#endif /* ADI_CFG_ENABLE_STATS */
@@ -0,0 +1,91 @@
+/*! *****************************************************************************
+ * @file:    adi_tmr_def_v1.h
+ * @brief:   GP timer service private definitions
+ -----------------------------------------------------------------------------
+Copyright (c) 2010-2014 Analog Devices, Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+  - Modified versions of the software must be conspicuously marked as such.
+  - This software is licensed solely and exclusively for use with processors
+    manufactured by or for Analog Devices, Inc.
+  - This software may not be combined or merged with other code in any manner
+    that would cause the software to become subject to terms and conditions
+    which differ from those listed here.
+  - Neither the name of Analog Devices, Inc. nor the names of its
+    contributors may be used to endorse or promote products derived
+    from this software without specific prior written permission.
+  - The use of this software may or may not infringe the patent rights of one
+    or more patent holders.  This license does not release you from the
+    requirement that you obtain separate licenses from these patent holders
+    to use this software.
+
+THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-
+INFRINGEMENT, TITLE, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL ANALOG DEVICES, INC. OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, PUNITIVE OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, DAMAGES ARISING OUT OF
+CLAIMS OF INTELLECTUAL PROPERTY RIGHTS INFRINGEMENT; PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#ifndef _ADI_TMR_DEF_H_
+#define _ADI_TMR_DEF_H_
+
+/*! \cond PRIVATE */
+
+/* Number of GP timers */
+#define ADI_TMR_NUM_INSTANCES   3u
+
+/*! \struct ADI_TMR_DEV_DATA
+ *  GP timer instance data, placed in the memory given to adi_tmr_Open().
+ */
+typedef struct _ADI_TMR_DEV_DATA
+{
+    ADI_CALLBACK  pfCallback;     /*!< Application supplied callback function */
+    void         *pCBParam;       /*!< Callback parm passed back in callbacks */
+} ADI_TMR_DEV_DATA;
+
+/*! \struct ADI_TMR_DRIVER_STRUCT
+ *  GP timer device structure
+ */
+typedef struct _ADI_TMR_DRIVER_STRUCT
+{
+    ADI_TMR_TypeDef  *const pReg;  /*!< Pointer to register base                 */
+    IRQn_Type         const IRQn;  /*!< Timer interrupt number                   */
+    ADI_TMR_DEV_DATA *pData;       /*!< Pointer to device data structure         */
+} ADI_TMR_DRIVER_STRUCT;
+
+#if (ADI_TIMER_ENABLE_STATIC_CONFIG_SUPPORT == 1)
+/*! \struct ADI_TMR_STATIC_INIT
+ *  conditionally create static initialization data based on adi_tmr_config.h settings
+ */
+typedef struct _ADI_TMR_STATIC_INIT
+{
+    uint16_t nCtl;                /*!< Control register (without the enable bit) */
+    uint16_t nLoad;               /*!< Load register                             */
+    uint16_t nALoad;              /*!< Asynchronous load register                */
+    uint16_t nPwmCtl;             /*!< PWM control register                      */
+    uint16_t nPwmMatch;           /*!< PWM match register                        */
+} ADI_TMR_STATIC_INIT;
+#endif
+
+/* alias for the actual device structure */
+typedef ADI_TMR_DRIVER_STRUCT      ADI_TMR_DRIVER;
+
+/*! \endcond */
+
+#endif /* _ADI_TMR_DEF_H_ */
@@ -0,0 +1,882 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_tmr_v1.c
+ * @brief:   GP timer service for ADuCM302x
+ * @details: Thin service over the three general purpose timers. Timeout and
+ *           capture events are reported through the registered callback from
+ *           the timer interrupt handler.
+ *-----------------------------------------------------------------------------
+
+Copyright (c) 2010-2014 Analog Devices, Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+  - Modified versions of the software must be conspicuously marked as such.
+  - This software is licensed solely and exclusively for use with processors
+    manufactured by or for Analog Devices, Inc.
+  - This software may not be combined or merged with other code in any manner
+    that would cause the software to become subject to terms and conditions
+    which differ from those listed here.
+  - Neither the name of Analog Devices, Inc. nor the names of its
+    contributors may be used to endorse or promote products derived
+    from this software without specific prior written permission.
+  - The use of this software may or may not infringe the patent rights of one
+    or more patent holders.  This license does not release you from the
+    requirement that you obtain separate licenses from these patent holders
+    to use this software.
+
+THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-
+INFRINGEMENT, TITLE, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL ANALOG DEVICES, INC. OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, PUNITIVE OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, DAMAGES ARISING OUT OF
+CLAIMS OF INTELLECTUAL PROPERTY RIGHTS INFRINGEMENT; PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#ifndef _ADI_TMR_V1_C_
+#define _ADI_TMR_V1_C_
+
+/*==========  I N C L U D E  ==========*/
+
+#include <string.h>
+#include <stddef.h>
+#include <services/int/adi_int.h>
+
+#include <ssdd_common/common_def.h>
+#include <services/tmr/adi_tmr.h>
+
+#include "adi_tmr_def_v1.h"
+
+#ifdef __ICCARM__
+/*
+* IAR MISRA C 2004 error suppressions.
+*
+* Pm123 (rule 8.5): there shall be no definition of objects or functions in a header file
+*   This isn't a header as such.
+*
+* Pm073 (rule 14.7): a function should have a single point of exit
+* Pm143 (rule 14.7): a function should have a single point of exit at the end of the function
+*   Multiple returns are used for error handling.
+*
+* Pm050 (rule 14.2): a null statement shall only occur on a line by itself
+*   Needed for null expansion of ADI_INSTALL_HANDLER and others.
+*/
+#pragma diag_suppress=Pm123,Pm073,Pm143,Pm050
+#endif /* __ICCARM__ */
+
+/* GP timer interrupt handlers */
+ADI_INT_HANDLER(GP_Tmr0_Int_Handler);
+ADI_INT_HANDLER(GP_Tmr1_Int_Handler);
+ADI_INT_HANDLER(GP_Tmr2_Int_Handler);
+
+/*==========  D A T A  ==========*/
+#ifdef __ICCARM__
+/*
+* Pm140 (rule 11.3): a cast should not be performed between a pointer type and an integral type
+*   The rule makes an exception for MMR address casts as in the pADI_TMRx macros here.
+*/
+#pragma diag_suppress=Pm140
+#endif /* __ICCARM__ */
+static ADI_TMR_DRIVER adi_tmr_Device[ADI_TMR_NUM_INSTANCES] =
+{
+    { pADI_TMR0, TMR0_EVT_IRQn, NULL },
+    { pADI_TMR1, TMR1_EVT_IRQn, NULL },
+    { pADI_TMR2, TMR2_EVT_IRQn, NULL }
+};
+#ifdef __ICCARM__
+#pragma diag_default=Pm140
+#endif /* __ICCARM__ */
+
+#if (ADI_TIMER_ENABLE_STATIC_CONFIG_SUPPORT == 1)
+static const ADI_TMR_STATIC_INIT gTmrStaticInitData[ADI_TMR_NUM_INSTANCES] =
+{
+    {
+        ( (TMR0_CFG_PRESCALE_FACTOR      << BITP_TMR_CTL_PRE)
+        | (TMR0_CFG_COUNT_UP             << BITP_TMR_CTL_UP)
+        | (TMR0_CFG_MODE                 << BITP_TMR_CTL_MODE)
+        | (TMR0_CFG_CLOCK_SOURCE         << BITP_TMR_CTL_CLK)
+        | (TMR0_CFG_RELOAD_CONTROL       << BITP_TMR_CTL_RLD)
+        | (TMR0_CFG_EVENT_CAPTURE        << BITP_TMR_CTL_EVTRANGE)
+        | (TMR0_CFG_ENABLE_EVENT_CAPTURE << BITP_TMR_CTL_EVTEN)
+        ),
+        TMR0_CFG_LOAD_VALUE,
+        TMR0_CFG_ASYNC_LOAD_VALUE,
+        ( (TMR0_CFG_ENABLE_PWM_MATCH_MODE << BITP_TMR_PWMCTL_MATCH)
+        | (TMR0_CFG_PWM_IDLE_STATE        << BITP_TMR_PWMCTL_IDLESTATE)
+        ),
+        TMR0_CFG_PWM_MATCH_VALUE
+    },
+    {
+        ( (TMR1_CFG_PRESCALE_FACTOR      << BITP_TMR_CTL_PRE)
+        | (TMR1_CFG_COUNT_UP             << BITP_TMR_CTL_UP)
+        | (TMR1_CFG_MODE                 << BITP_TMR_CTL_MODE)
+        | (TMR1_CFG_CLOCK_SOURCE         << BITP_TMR_CTL_CLK)
+        | (TMR1_CFG_RELOAD_CONTROL       << BITP_TMR_CTL_RLD)
+        | (TMR1_CFG_EVENT_CAPTURE        << BITP_TMR_CTL_EVTRANGE)
+        | (TMR1_CFG_ENABLE_EVENT_CAPTURE << BITP_TMR_CTL_EVTEN)
+        ),
+        TMR1_CFG_LOAD_VALUE,
+        TMR1_CFG_ASYNC_LOAD_VALUE,
+        ( (TMR1_CFG_ENABLE_PWM_MATCH_MODE << BITP_TMR_PWMCTL_MATCH)
+        | (TMR1_CFG_PWM_IDLE_STATE        << BITP_TMR_PWMCTL_IDLESTATE)
+        ),
+        TMR1_CFG_PWM_MATCH_VALUE
+    },
+    {
+        ( (TMR2_CFG_PRESCALE_FACTOR      << BITP_TMR_CTL_PRE)
+        | (TMR2_CFG_COUNT_UP             << BITP_TMR_CTL_UP)
+        | (TMR2_CFG_MODE                 << BITP_TMR_CTL_MODE)
+        | (TMR2_CFG_CLOCK_SOURCE         << BITP_TMR_CTL_CLK)
+        | (TMR2_CFG_RELOAD_CONTROL       << BITP_TMR_CTL_RLD)
+        | (TMR2_CFG_EVENT_CAPTURE        << BITP_TMR_CTL_EVTRANGE)
+        | (TMR2_CFG_ENABLE_EVENT_CAPTURE << BITP_TMR_CTL_EVTEN)
+        ),
+        TMR2_CFG_LOAD_VALUE,
+        TMR2_CFG_ASYNC_LOAD_VALUE,
+        ( (TMR2_CFG_ENABLE_PWM_MATCH_MODE << BITP_TMR_PWMCTL_MATCH)
+        | (TMR2_CFG_PWM_IDLE_STATE        << BITP_TMR_PWMCTL_IDLESTATE)
+        ),
+        TMR2_CFG_PWM_MATCH_VALUE
+    }
+};
+#endif
+
+/*==========  L O C A L   F U N C T I O N S  ==========*/
+
+/* Wait for the clock domain synchronization of the last register write */
+static void WaitForSync(ADI_TMR_TypeDef const *pReg)
+{
+    while ((pReg->STAT & BITM_TMR_STAT_BUSY) != 0u) {}
+}
+
+#ifdef ADI_DEBUG
+/* Validate a device handle */
+static ADI_TMR_RESULT ValidateHandle(ADI_TMR_HANDLE const hDevice)
+{
+    uint32_t i;
+
+    for (i = 0u; i < ADI_TMR_NUM_INSTANCES; i++)
+    {
+        if (hDevice == (ADI_TMR_HANDLE)&adi_tmr_Device[i])
+        {
+            return (adi_tmr_Device[i].pData != NULL) ? ADI_TMR_SUCCESS : ADI_TMR_INVALID_HANDLE;
+        }
+    }
+    return ADI_TMR_INVALID_HANDLE;
+}
+#endif
+
+/* Update CTL fields which can only be changed while the timer is disabled */
+static ADI_TMR_RESULT SetControlField(ADI_TMR_HANDLE const hDevice, uint16_t nMask, uint16_t nValue)
+{
+    ADI_TMR_DRIVER *pDevice = (ADI_TMR_DRIVER *)hDevice;
+    ADI_TMR_TypeDef *pReg;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+    pReg = pDevice->pReg;
+
+#ifdef ADI_DEBUG
+    if ((pReg->CTL & BITM_TMR_CTL_EN) != 0u)
+    {
+        return ADI_TMR_OPERATION_NOT_ALLOWED;
+    }
+#endif
+
+    WaitForSync(pReg);
+
+    ADI_ENTER_CRITICAL_REGION();
+    pReg->CTL = (uint16_t)((pReg->CTL & (uint16_t)~nMask) | (nValue & nMask));
+    ADI_EXIT_CRITICAL_REGION();
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*! \addtogroup GP_Timer_Service
+ *  @{
+ */
+
+/*!
+    @brief      Open a GP timer for use.
+
+    @param[in]  DeviceNumber    Timer to open (0 to 2).
+    @param[in]  pDeviceMemory   Pointer to the memory to be used by the service.
+                                Size of the memory should be atleast #ADI_TMR_MEMORY_SIZE bytes.
+    @param[in]  MemorySize      Size of the memory passed in pDeviceMemory parameter.
+    @param[out] phDevice        Pointer to a location where the timer handle is written.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully opened.
+                - #ADI_TMR_INVALID_TIMERID [D] if DeviceNumber is out of range.
+                - #ADI_TMR_INVALID_POINTER [D] if pDeviceMemory or phDevice is NULL.
+                - #ADI_TMR_INSUFFICIENT_MEMORY [D] if MemorySize is too small.
+                - #ADI_TMR_IN_USE [D] if the timer is already open.
+
+    The timer is left disabled. When ADI_TIMER_ENABLE_STATIC_CONFIG_SUPPORT is 1 it is
+    configured from adi_tmr_config.h. The timer interrupt is enabled in the NVIC.
+
+    @sa         adi_tmr_Close().
+*/
+ADI_TMR_RESULT adi_tmr_Open(
+               uint32_t         DeviceNumber,
+               void            *pDeviceMemory,
+               uint32_t         MemorySize,
+               ADI_TMR_HANDLE  *phDevice
+               )
+{
+    ADI_TMR_DRIVER *pDevice;
+    ADI_TMR_TypeDef *pReg;
+
+#ifdef ADI_DEBUG
+    if (DeviceNumber >= ADI_TMR_NUM_INSTANCES)
+    {
+        return ADI_TMR_INVALID_TIMERID;
+    }
+    if ((pDeviceMemory == NULL) || (phDevice == NULL))
+    {
+        return ADI_TMR_INVALID_POINTER;
+    }
+    if (MemorySize < sizeof(ADI_TMR_DEV_DATA))
+    {
+        return ADI_TMR_INSUFFICIENT_MEMORY;
+    }
+    if (adi_tmr_Device[DeviceNumber].pData != NULL)
+    {
+        return ADI_TMR_IN_USE;
+    }
+#endif
+
+    memset(pDeviceMemory, 0, MemorySize);
+    pDevice = &adi_tmr_Device[DeviceNumber];
+    pReg = pDevice->pReg;
+
+    /* Make sure the timer is stopped and no event is pending */
+    WaitForSync(pReg);
+    pReg->CTL &= (uint16_t)~BITM_TMR_CTL_EN;
+    WaitForSync(pReg);
+    pReg->CLRINT = BITM_TMR_CLRINT_TIMEOUT | BITM_TMR_CLRINT_EVTCAPT;
+
+#if (ADI_TIMER_ENABLE_STATIC_CONFIG_SUPPORT == 1)
+    {
+        ADI_TMR_STATIC_INIT const *pInitData = &gTmrStaticInitData[DeviceNumber];
+
+        WaitForSync(pReg);
+        pReg->CTL      = pInitData->nCtl;
+        WaitForSync(pReg);
+        pReg->LOAD     = pInitData->nLoad;
+        /* The asynchronous load value takes precedence when set */
+        if (pInitData->nALoad != 0u)
+        {
+            pReg->ALOAD = pInitData->nALoad;
+        }
+        pReg->PWMCTL   = pInitData->nPwmCtl;
+        pReg->PWMMATCH = pInitData->nPwmMatch;
+    }
+#endif
+
+    pDevice->pData = (ADI_TMR_DEV_DATA *)pDeviceMemory;
+
+    /* install interrupt handler */
+    switch (DeviceNumber)
+    {
+    case 0u:
+        ADI_INSTALL_HANDLER(pDevice->IRQn, GP_Tmr0_Int_Handler);
+        break;
+    case 1u:
+        ADI_INSTALL_HANDLER(pDevice->IRQn, GP_Tmr1_Int_Handler);
+        break;
+    default:
+        ADI_INSTALL_HANDLER(pDevice->IRQn, GP_Tmr2_Int_Handler);
+        break;
+    }
+    ADI_ENABLE_INT(pDevice->IRQn);
+
+    *phDevice = (ADI_TMR_HANDLE)pDevice;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Stop and close a GP timer.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully closed.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+
+    @sa         adi_tmr_Open().
+*/
+ADI_TMR_RESULT adi_tmr_Close(
+               ADI_TMR_HANDLE hDevice
+               )
+{
+    ADI_TMR_DRIVER *pDevice = (ADI_TMR_DRIVER *)hDevice;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    ADI_DISABLE_INT(pDevice->IRQn);
+    ADI_UNINSTALL_HANDLER(pDevice->IRQn);
+
+    WaitForSync(pDevice->pReg);
+    pDevice->pReg->CTL &= (uint16_t)~BITM_TMR_CTL_EN;
+
+    pDevice->pData = NULL;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Get the timer value latched by the last captured event.
+
+    @param[in]  hDevice         Timer handle obtained from adi_tmr_Open().
+    @param[out] pCapturedValue  Pointer to a location where the captured value is written.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully read.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_INVALID_POINTER [D] if pCapturedValue is NULL.
+*/
+ADI_TMR_RESULT adi_tmr_GetCapturedValue(
+               ADI_TMR_HANDLE hDevice,
+               uint16_t *pCapturedValue
+               )
+{
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+    if (pCapturedValue == NULL)
+    {
+        return ADI_TMR_INVALID_POINTER;
+    }
+#endif
+
+    *pCapturedValue = ((ADI_TMR_DRIVER *)hDevice)->pReg->CAPTURE;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Get whether a register write is still being synchronized.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[out] pbBusy     Pointer to a location where the busy status is written.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully read.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_INVALID_POINTER [D] if pbBusy is NULL.
+*/
+ADI_TMR_RESULT adi_tmr_IsBusy(
+               ADI_TMR_HANDLE hDevice,
+               bool_t *pbBusy
+               )
+{
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+    if (pbBusy == NULL)
+    {
+        return ADI_TMR_INVALID_POINTER;
+    }
+#endif
+
+    *pbBusy = ((((ADI_TMR_DRIVER *)hDevice)->pReg->STAT & BITM_TMR_STAT_BUSY) != 0u);
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Set the value the counter is reloaded with in periodic mode.
+
+    @param[in]  hDevice     Timer handle obtained from adi_tmr_Open().
+    @param[in]  nLoadValue  Load value.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+
+    @note       The load value can be changed while the timer is running, the new
+                value is used from the next timeout.
+*/
+ADI_TMR_RESULT adi_tmr_SetLoadValue(
+               ADI_TMR_HANDLE hDevice,
+               const uint16_t nLoadValue
+               )
+{
+    ADI_TMR_TypeDef *pReg;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    pReg = ((ADI_TMR_DRIVER *)hDevice)->pReg;
+    WaitForSync(pReg);
+    pReg->LOAD = nLoadValue;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Get the load value.
+
+    @param[in]  hDevice      Timer handle obtained from adi_tmr_Open().
+    @param[out] pTimerLdVal  Pointer to a location where the load value is written.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully read.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_INVALID_POINTER [D] if pTimerLdVal is NULL.
+*/
+ADI_TMR_RESULT adi_tmr_GetLoadValue(
+               ADI_TMR_HANDLE hDevice,
+               uint16_t *pTimerLdVal
+               )
+{
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+    if (pTimerLdVal == NULL)
+    {
+        return ADI_TMR_INVALID_POINTER;
+    }
+#endif
+
+    *pTimerLdVal = ((ADI_TMR_DRIVER *)hDevice)->pReg->LOAD;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Get the current counter value.
+
+    @param[in]  hDevice      Timer handle obtained from adi_tmr_Open().
+    @param[out] pTimerValue  Pointer to a location where the counter value is written.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully read.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_INVALID_POINTER [D] if pTimerValue is NULL.
+*/
+ADI_TMR_RESULT adi_tmr_GetCurrentValue(
+               ADI_TMR_HANDLE hDevice,
+               uint16_t *pTimerValue
+               )
+{
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+    if (pTimerValue == NULL)
+    {
+        return ADI_TMR_INVALID_POINTER;
+    }
+#endif
+
+    *pTimerValue = ((ADI_TMR_DRIVER *)hDevice)->pReg->CURCNT;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Enable or disable capturing of the event selected by adi_tmr_SetEventToCapture().
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  bEnable    'true' to enable event capture.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_EnableEventCapture(
+               ADI_TMR_HANDLE hDevice,
+               bool_t bEnable
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_EVTEN, bEnable ? BITM_TMR_CTL_EVTEN : 0u);
+}
+
+/*!
+    @brief      Set the prescaler applied to the timer clock.
+
+    @param[in]  hDevice     Timer handle obtained from adi_tmr_Open().
+    @param[in]  ePreScaler  Prescaler.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_SetPrescaler(
+               ADI_TMR_HANDLE hDevice,
+               ADI_TMR_PRESCALER ePreScaler
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_PRE, (uint16_t)ePreScaler);
+}
+
+/*!
+    @brief      Start or stop the timer.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  bEnable    'true' to start the timer, 'false' to stop it.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+*/
+ADI_TMR_RESULT adi_tmr_Enable(
+               ADI_TMR_HANDLE hDevice,
+               bool_t bEnable
+               )
+{
+    ADI_TMR_TypeDef *pReg;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    pReg = ((ADI_TMR_DRIVER *)hDevice)->pReg;
+    WaitForSync(pReg);
+
+    ADI_ENTER_CRITICAL_REGION();
+    if (bEnable)
+    {
+        pReg->CTL |= BITM_TMR_CTL_EN;
+    }
+    else
+    {
+        pReg->CTL &= (uint16_t)~BITM_TMR_CTL_EN;
+    }
+    ADI_EXIT_CRITICAL_REGION();
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Select periodic or free running mode.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  eMode      Running mode.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_SetRunMode(
+               ADI_TMR_HANDLE hDevice,
+               ADI_TMR_RUNNING_MODE eMode
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_MODE, (uint16_t)eMode);
+}
+
+/*!
+    @brief      Select whether the timer counts up or down.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  eMode      Count mode.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_SetCountMode(
+               ADI_TMR_HANDLE hDevice,
+               ADI_TMR_COUNT_MODE eMode
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_UP, (uint16_t)eMode);
+}
+
+/*!
+    @brief      Select the timer clock source.
+
+    @param[in]  hDevice       Timer handle obtained from adi_tmr_Open().
+    @param[in]  eClockSource  Clock source.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_SetClockSource(
+               ADI_TMR_HANDLE hDevice,
+               ADI_TMR_CLOCK_SOURCE eClockSource
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_CLK, (uint16_t)eClockSource);
+}
+
+/*!
+    @brief      Set the PWM output idle state.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  bIdleHigh  'true' if the PWM output idles high.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+*/
+ADI_TMR_RESULT adi_tmr_SetPWMidle(
+               ADI_TMR_HANDLE hDevice,
+               bool_t bIdleHigh)
+{
+    ADI_TMR_TypeDef *pReg;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    pReg = ((ADI_TMR_DRIVER *)hDevice)->pReg;
+
+    ADI_ENTER_CRITICAL_REGION();
+    if (bIdleHigh)
+    {
+        pReg->PWMCTL |= BITM_TMR_PWMCTL_IDLESTATE;
+    }
+    else
+    {
+        pReg->PWMCTL &= (uint16_t)~BITM_TMR_PWMCTL_IDLESTATE;
+    }
+    ADI_EXIT_CRITICAL_REGION();
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Select the PWM toggle or match mode.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  eMode      PWM mode.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+*/
+ADI_TMR_RESULT adi_tmr_SetPWMMode(
+               ADI_TMR_HANDLE hDevice,
+               ADI_TMR_PWM_MODE  eMode
+               )
+{
+    ADI_TMR_TypeDef *pReg;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    pReg = ((ADI_TMR_DRIVER *)hDevice)->pReg;
+
+    ADI_ENTER_CRITICAL_REGION();
+    pReg->PWMCTL = (uint16_t)((pReg->PWMCTL & (uint16_t)~BITM_TMR_PWMCTL_MATCH) | (uint16_t)eMode);
+    ADI_EXIT_CRITICAL_REGION();
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Set the PWM match value.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  nValue     Counter value at which the PWM output is asserted in match mode.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+*/
+ADI_TMR_RESULT adi_tmr_SetPWMMatchValue(
+               ADI_TMR_HANDLE hDevice,
+               uint16_t  nValue
+               )
+{
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    ((ADI_TMR_DRIVER *)hDevice)->pReg->PWMMATCH = nValue;
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*!
+    @brief      Select the event which latches the counter into the capture register.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  eEvent     Event, one of the ADI_TMRx_CAPTURE_EVENT_xxx values of this timer.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_SetEventToCapture(
+               ADI_TMR_HANDLE hDevice,
+               ADI_TMR_CAPTURE_EVENTS eEvent
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_EVTRANGE, (uint16_t)eEvent);
+}
+
+/*!
+    @brief      Select whether clearing the timeout interrupt also reloads the counter.
+
+    @param[in]  hDevice    Timer handle obtained from adi_tmr_Open().
+    @param[in]  bEnable    'true' to reload the counter when the interrupt is cleared.
+
+    @return     Status
+                - #ADI_TMR_SUCCESS if successfully set.
+                - #ADI_TMR_INVALID_HANDLE [D] if the handle is invalid.
+                - #ADI_TMR_OPERATION_NOT_ALLOWED [D] if the timer is enabled.
+*/
+ADI_TMR_RESULT adi_tmr_EnableReloading(
+               ADI_TMR_HANDLE hDevice,
+               bool_t bEnable
+               )
+{
+    return SetControlField(hDevice, BITM_TMR_CTL_RLD, bEnable ? BITM_TMR_CTL_RLD : 0u);
+}
+
+/**
+ * @brief       Registers a Callback function with the timer. The registered call
+ *              back function will be called from the timer interrupt with
+ *              #ADI_TMR_EVENT_TIMEOUT or #ADI_TMR_EVENT_CAPTURED.
+ *
+ * @param [in]  hDevice     Timer handle obtained from adi_tmr_Open().
+ *
+ * @param [in]  pfCallback  Function pointer to Callback function. Passing a NULL pointer will
+ *                          unregister the call back function.
+ *
+ * @param [in]  pCBparam    Call back function parameter.
+ *
+ * @return      Status
+ *
+ *  - #ADI_TMR_SUCCESS                    Successfully registered specified callback function.
+ *
+ *  - #ADI_TMR_INVALID_HANDLE      [D]  Invalid timer handle.
+ */
+ADI_TMR_RESULT adi_tmr_RegisterCallback(
+               ADI_TMR_HANDLE const  hDevice,
+               ADI_CALLBACK   const   pfCallback,
+               void        *const     pCBparam
+               )
+{
+    ADI_TMR_DRIVER *pDevice = (ADI_TMR_DRIVER *)hDevice;
+
+#ifdef ADI_DEBUG
+    if (ValidateHandle(hDevice) != ADI_TMR_SUCCESS)
+    {
+        return ADI_TMR_INVALID_HANDLE;
+    }
+#endif
+
+    ADI_ENTER_CRITICAL_REGION();
+    pDevice->pData->pfCallback = pfCallback;
+    pDevice->pData->pCBParam   = pCBparam;
+    ADI_EXIT_CRITICAL_REGION();
+
+    return ADI_TMR_SUCCESS;
+}
+
+/*! @} */
+
+/*! \cond PRIVATE */
+
+/* Clear the pending timer events and report them to the application */
+static void TimerInterrupt(ADI_TMR_DRIVER const *pDevice)
+{
+    ADI_TMR_TypeDef *pReg = pDevice->pReg;
+    ADI_TMR_DEV_DATA *pData = pDevice->pData;
+    uint16_t nStatus = pReg->STAT & (BITM_TMR_STAT_TIMEOUT | BITM_TMR_STAT_CAPTURE);
+
+    /* The CLRINT bits line up with the STAT event bits */
+    pReg->CLRINT = nStatus;
+
+    if ((pData != NULL) && (pData->pfCallback != NULL))
+    {
+        if ((nStatus & BITM_TMR_STAT_TIMEOUT) != 0u)
+        {
+            pData->pfCallback(pData->pCBParam, (uint32_t)ADI_TMR_EVENT_TIMEOUT, NULL);
+        }
+        if ((nStatus & BITM_TMR_STAT_CAPTURE) != 0u)
+        {
+            pData->pfCallback(pData->pCBParam, (uint32_t)ADI_TMR_EVENT_CAPTURED, NULL);
+        }
+    }
+}
+
+/*! @brief  GP timer interrupt handlers.  Override the weakly-bound default interrupt handlers in startup.c. */
+ADI_INT_HANDLER (GP_Tmr0_Int_Handler)
+{
+    ISR_PROLOG();
+    TimerInterrupt(&adi_tmr_Device[0]);
+    ISR_EPILOG();
+}
+
+ADI_INT_HANDLER (GP_Tmr1_Int_Handler)
+{
+    ISR_PROLOG();
+    TimerInterrupt(&adi_tmr_Device[1]);
+    ISR_EPILOG();
+}
+
+ADI_INT_HANDLER (GP_Tmr2_Int_Handler)
+{
+    ISR_PROLOG();
+    TimerInterrupt(&adi_tmr_Device[2]);
+    ISR_EPILOG();
+}
+/*! \endcond */
+
+#endif /* _ADI_TMR_V1_C_ */
+
+/*
+** EOF
+*/
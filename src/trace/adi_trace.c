@@ -0,0 +1,102 @@
+/*!
+ *****************************************************************************
+ * @file:    adi_trace.c
+ * @brief:   Cycle stamped event trace for the drivers and interrupt handlers
+ *-----------------------------------------------------------------------------
+ *
+ * Recording costs one masked section of about 20 cycles: the slot is claimed
+ * and filled with interrupts masked so nested handlers never interleave their
+ * records. The PRIMASK is restored, not cleared, so the drivers may record
+ * from inside their own critical regions.
+ *
+ *****************************************************************************/
+#include <adi_processor.h>
+#include <services/pwr/adi_pwr.h>
+#include <services/trace/adi_trace.h>
+
+#if (ADI_CFG_ENABLE_TRACE == 1)
+
+#if ((ADI_CFG_TRACE_SIZE) & ((ADI_CFG_TRACE_SIZE) - 1)) != 0
+#error "ADI_CFG_TRACE_SIZE must be a power of two"
+#endif
+
+ADI_TRACE_BUFFER adi_trace_Buffer;
+
+/**
+ * @brief  Clear the trace buffer and start recording
+ *
+ * Starts the DWT cycle counter. Call after the clock dividers are set so
+ * the recorded HCLK matches the cycle counts.
+ */
+void adi_trace_Start (void)
+{
+    uint32_t nClock = 0u;
+
+    (void)adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &nClock);
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    adi_trace_Buffer.bEnabled = 0u;
+    adi_trace_Buffer.nSize    = ADI_CFG_TRACE_SIZE;
+    adi_trace_Buffer.nWritten = 0u;
+    adi_trace_Buffer.nClock   = nClock;
+    adi_trace_Buffer.nMagic   = ADI_TRACE_MAGIC;
+    adi_trace_Buffer.bEnabled = 1u;
+}
+
+/**
+ * @brief  Freeze the trace buffer
+ *
+ * Call when the event of interest has happened so later records do not
+ * overwrite it, then dump adi_trace_Buffer.
+ */
+void adi_trace_Stop (void)
+{
+    adi_trace_Buffer.bEnabled = 0u;
+}
+
+/**
+ * @brief  Record an event
+ *
+ * @param [in]  eEvent  Event.
+ * @param [in]  nArg    Event argument, the low 16 bits are kept.
+ *
+ * Use ADI_TRACE() so the call disappears when the trace is disabled.
+ */
+void adi_trace_Record (ADI_TRACE_EVENT const eEvent, uint32_t const nArg)
+{
+    ADI_TRACE_RECORD *pRecord;
+    uint32_t nPrimask;
+
+    if (adi_trace_Buffer.bEnabled == 0u)
+    {
+        return;
+    }
+
+    nPrimask = __get_PRIMASK();
+    __disable_irq();
+
+    pRecord = &adi_trace_Buffer.aRecords[adi_trace_Buffer.nWritten & (ADI_CFG_TRACE_SIZE - 1u)];
+    pRecord->nCycles = DWT->CYCCNT;
+    pRecord->nEvent  = (uint16_t)eEvent;
+    pRecord->nArg    = (uint16_t)nArg;
+    adi_trace_Buffer.nWritten++;
+
+    __set_PRIMASK(nPrimask);
+}
+
+/**
+ * @brief  Record an interrupt handler boundary
+ *
+ * @param [in]  eEvent  ADI_TRACE_ISR_BEGIN or ADI_TRACE_ISR_END.
+ *
+ * Called by ISR_PROLOG() and ISR_EPILOG(), the argument is the active
+ * exception number so one hook serves every handler.
+ */
+void adi_trace_Isr (ADI_TRACE_EVENT const eEvent)
+{
+    adi_trace_Record(eEvent, __get_IPSR());
+}
+
+#endif /* ADI_CFG_ENABLE_TRACE */
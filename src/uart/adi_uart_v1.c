@@ -619,6 +619,7 @@ ADI_UART_RESULT adi_uart_SubmitTxBuffer(
     }
     /* Check for the data transfer mode */
     pDevice->pChannelTx->eDataTranferMode = ADI_UART_DATA_TRANSFER_MODE_NONBLOCKING;
+    ADI_TRACE(ADI_TRACE_UART_SUBMIT_TX, nBufSize);
 #if (ADI_UART_CFG_ENABLE_DMA_SUPPORT ==1)
     pDevice->pChannelTx->oDMADescriptor.pSrcData = pBuffer;
     pDevice->pChannelTx->oDMADescriptor.NumTransfers = nBufSize;
@@ -694,6 +695,7 @@ ADI_UART_RESULT adi_uart_SubmitRxBuffer(
     }
     /* Check for the data transfer mode */
     pDevice->pChannelRx->eDataTranferMode = ADI_UART_DATA_TRANSFER_MODE_NONBLOCKING;
+    ADI_TRACE(ADI_TRACE_UART_SUBMIT_RX, nBufSize);
 
 #if (ADI_UART_CFG_ENABLE_DMA_SUPPORT ==1)
     pDevice->pChannelRx->oDMADescriptor.pDstData = pBuffer;
@@ -2431,6 +2433,7 @@ static ADI_UART_RESULT uart_SubmittBufferIntmode(UART_DATA_CHANNEL *pChannel, vo
  *
 */
 
+ADI_ISRAM_CODE
 ADI_INT_HANDLER(UART_Int_Handler)
 {
     ISR_PROLOG();
@@ -2457,6 +2460,7 @@ ADI_INT_HANDLER(UART_Int_Handler)
             nStatus =   pDevice->pUARTRegs->COMLSR;
             if((BITM_UART_COMLSR_BI & nStatus) == BITM_UART_COMLSR_BI)
             {
+                ADI_STATS_INC(Uart.nBreaks);
                 ADI_UART_RBR_GET();
                 pDevice->pChannelRx->pProcDesc->nIndex=0u; 
                 nEvent  =(uint32_t) ADI_UART_EVENT_BREAK_INTERRUPT;
@@ -2465,14 +2469,17 @@ ADI_INT_HANDLER(UART_Int_Handler)
 
             if((BITM_UART_COMLSR_FE & nStatus) == BITM_UART_COMLSR_FE)
             {
+                ADI_STATS_INC(Uart.nFramingErrors);
                 nEvent |=  (uint32_t)ADI_UART_HW_ERR_FRAMING;
             }
             if((BITM_UART_COMLSR_PE & nStatus) == BITM_UART_COMLSR_PE)
             {
+                ADI_STATS_INC(Uart.nParityErrors);
                 nEvent  |=  (uint32_t)ADI_UART_HW_ERR_PARITY;
             }
             if((BITM_UART_COMLSR_OE & nStatus) == BITM_UART_COMLSR_OE)
             {
+                ADI_STATS_INC(Uart.nOverrunErrors);
                 nEvent |= (uint32_t)ADI_UART_HW_ERR_OVERRUN;
             }
 
@@ -2752,6 +2759,16 @@ static void uart_mange_buffer(ADI_UART_DEVICE *pDevice,UART_DATA_CHANNEL *pChann
             pChannel->nActiveBufferCount -= 1U;
             /* Point to next Processing Buffer Node*/
             pChannel->pProcDesc = pChannel->pProcDesc->pNext;
+            if(eEvent == ADI_UART_EVENT_TX_BUFFER_PROCESSED)
+            {
+                ADI_STATS_INC(Uart.nTxBuffers);
+                ADI_STATS_ADD(Uart.nTxBytes, pProcDesc->nCount);
+            }
+            else
+            {
+                ADI_STATS_INC(Uart.nRxBuffers);
+                ADI_STATS_ADD(Uart.nRxBytes, pProcDesc->nCount);
+            }
             if(pDevice->pfCallback == NULL)
             {
                  POST_EVENT(pChannel);
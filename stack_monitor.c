@@ -0,0 +1,160 @@
+
+#include <stddef.h>
+#include <string.h>
+#include <adi_processor.h>
+
+#include "stack_monitor.h"
+#include "block_pool.h"
+#include "packetizer.h"
+
+#define FRAME_HEADER_SIZE   3u          //SYNC, ID, LENGTH
+#define REPORT_MAX_SIZE     (13u + STACK_MONITOR_NAME_MAX)//largest payload, a pool section
+
+#pragma segment="CSTACK"
+#define STACK_BEGIN         ((uint32_t *)__sfb("CSTACK"))
+#define STACK_END           ((uint32_t *)__sfe("CSTACK"))
+
+static volatile uint8_t  Request;//1 until StackMonitor_Poll takes the request
+
+
+/********************************************************************
+* Send one report frame                                              *
+*********************************************************************/
+static unsigned char SendReport(uint8_t const *_payload, uint8_t _length)
+{
+  uint8_t frame[FRAME_HEADER_SIZE + REPORT_MAX_SIZE];
+
+  frame[0] = CMD_FRAME_SYNC;
+  frame[1] = STACK_MONITOR_FRAME_ID;
+  frame[2] = _length;
+  memcpy(&frame[FRAME_HEADER_SIZE], _payload, _length);
+  return Packetizer_Write(frame, (uint16_t)(FRAME_HEADER_SIZE + _length));
+}
+
+static uint8_t *Put16(uint8_t *_p, uint32_t _value)
+{
+  *_p++ = (uint8_t)(_value >> 8);
+  *_p++ = (uint8_t)_value;
+  return _p;
+}
+
+static uint8_t *Put32(uint8_t *_p, uint32_t _value)
+{
+  _p = Put16(_p, _value >> 16);
+  return Put16(_p, _value);
+}
+
+
+/**********************************************************************************************
+* Function Name: StackMonitor_Paint
+* Description  : This function fills the stack from its lowest address up to the stack
+*                pointer with STACK_MONITOR_PATTERN. Whatever ran deeper before is forgotten.
+* Arguments    : void
+* Return Value : void
+**********************************************************************************************/
+void StackMonitor_Paint(void)
+{
+  uint32_t *p = STACK_BEGIN;
+  uint32_t *sp = (uint32_t *)__get_MSP();
+
+  //an interrupt in between only overwrites paint, which then counts as used
+  while(p < sp)
+  {
+    *p++ = STACK_MONITOR_PATTERN;
+  }
+}
+
+
+/**********************************************************************************************
+* Function Name: StackMonitor_Size
+* Description  : This function returns the size of the CSTACK section set in the linker file
+* Arguments    : void
+* Return Value : stack size in bytes
+**********************************************************************************************/
+uint32_t StackMonitor_Size(void)
+{
+  return (uint32_t)((uint8_t *)STACK_END - (uint8_t *)STACK_BEGIN);
+}
+
+
+/**********************************************************************************************
+* Function Name: StackMonitor_Peak
+* Description  : This function returns the deepest stack use since StackMonitor_Paint, found
+*                from the lowest word that no longer holds the pattern
+* Arguments    : void
+* Return Value : peak stack use in bytes, StackMonitor_Size() if the stack was exhausted
+**********************************************************************************************/
+uint32_t StackMonitor_Peak(void)
+{
+  uint32_t const *p = STACK_BEGIN;
+
+  while((p < STACK_END) && (*p == STACK_MONITOR_PATTERN))
+  {
+    p++;
+  }
+  return (uint32_t)((uint8_t const *)STACK_END - (uint8_t const *)p);
+}
+
+
+/**********************************************************************************************
+* Function Name: StackMonitor_OnRequest
+* Description  : Command handler for STACK_MONITOR_REQUEST_ID frames, see
+*                STACK_MONITOR_REQUEST_ENTRY. Only records the request, the report is sent by
+*                StackMonitor_Poll.
+* Arguments    : uint8_t const* _payload = unused
+*                uint8_t _length = 0
+* Return Value : void
+**********************************************************************************************/
+void StackMonitor_OnRequest(uint8_t const * _payload, uint8_t _length)
+{
+  Request = 1u;
+}
+
+
+/**********************************************************************************************
+* Function Name: StackMonitor_Poll
+* Description  : This function sends the report of a pending request: the stack, every block
+*                pool and an END frame
+* Arguments    : void
+* Return Value : 0 = Success
+*                1 = Failure (See eUartResult in debug mode for adi micro specific info)
+**********************************************************************************************/
+unsigned char StackMonitor_Poll(void)
+{
+  uint8_t payload[REPORT_MAX_SIZE];
+  uint8_t *p;
+  BLOCK_POOL const *pPool;
+  uint32_t i;
+
+  if(Request == 0u)
+    return 0;
+  Request = 0u;
+
+  p = payload;
+  *p++ = STACK_MONITOR_SECTION_STACK;
+  p = Put32(p, StackMonitor_Size());
+  p = Put32(p, StackMonitor_Peak());
+  p = Put32(p, (uint32_t)((uint8_t *)STACK_END - (uint8_t *)__get_MSP()));
+  if(SendReport(payload, (uint8_t)(p - payload)) != 0)
+    return 1;
+
+  for(pPool = BlockPool_First(); pPool != NULL; pPool = pPool->pNext)
+  {
+    p = payload;
+    *p++ = STACK_MONITOR_SECTION_POOL;
+    p = Put16(p, pPool->nBlockSize);
+    p = Put16(p, pPool->nCount);
+    p = Put16(p, BlockPool_InUse(pPool));
+    p = Put16(p, BlockPool_Peak(pPool));
+    p = Put32(p, pPool->nExhausted);
+    for(i = 0; (i < STACK_MONITOR_NAME_MAX) && (pPool->pName[i] != '\0'); i++)
+      *p++ = (uint8_t)pPool->pName[i];
+    if(SendReport(payload, (uint8_t)(p - payload)) != 0)
+      return 1;
+  }
+
+  payload[0] = STACK_MONITOR_SECTION_END;
+  if(SendReport(payload, 1u) != 0)
+    return 1;
+  return Packetizer_Flush();
+}
@@ -0,0 +1,78 @@
+
+#ifndef _STACK_MONITOR_H_
+#define _STACK_MONITOR_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include "command_parser.h"
+
+
+/******************************************************************************/
+/* stack monitor parameters                                                   */
+/******************************************************************************/
+
+/*
+ * Stack high-water mark. StackMonitor_Paint fills the unused part of CSTACK
+ * with STACK_MONITOR_PATTERN, the deepest word no longer holding the pattern
+ * gives the peak use since then. Interrupt handlers run on the same stack
+ * and are included.
+ *
+ * The report also lists the block pools (see block_pool.h).
+ *
+ * Host to device:
+ *   REQUEST payload = none
+ *
+ * Device to host, then an END frame:
+ *   STACK   payload = STACK_MONITOR_SECTION_STACK, stack size, peak use,
+ *                     current use (4 bytes each, in bytes)
+ *   POOL    payload = STACK_MONITOR_SECTION_POOL, block size (2 bytes), blocks
+ *                     (2 bytes), in use (2 bytes), peak in use (2 bytes),
+ *                     refused allocations (4 bytes), name
+ *   END     payload = STACK_MONITOR_SECTION_END
+ *
+ * All fields MSB first. The request is only recorded by the command handler,
+ * StackMonitor_Poll sends the report from the main loop. tools/ram_report.py
+ * --port prints it next to the static RAM of the link map.
+ */
+#define STACK_MONITOR_REQUEST_ID  8            //host to device, index in the command table
+#define STACK_MONITOR_FRAME_ID    0x15         //device to host
+
+#define STACK_MONITOR_PATTERN     0xA5A5A5A5u  //fill of the untouched stack
+#define STACK_MONITOR_NAME_MAX    12           //pool name bytes sent
+
+//report sections
+#define STACK_MONITOR_SECTION_STACK 0
+#define STACK_MONITOR_SECTION_POOL  1
+#define STACK_MONITOR_SECTION_END   0xFF
+
+#if ((STACK_MONITOR_REQUEST_ID) >= (CMD_TABLE_SIZE))
+#error "STACK_MONITOR_REQUEST_ID must be a valid command table index"
+#endif
+
+//command table entry for the REQUEST frame
+#define STACK_MONITOR_REQUEST_ENTRY { StackMonitor_OnRequest, 0, 0 }
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//fill the stack below the caller, first thing in main
+void StackMonitor_Paint(void);
+
+//size of CSTACK in bytes
+uint32_t StackMonitor_Size(void);
+
+//deepest stack use since StackMonitor_Paint, in bytes
+uint32_t StackMonitor_Peak(void);
+
+//REQUEST frame handler, called by the command parser
+void StackMonitor_OnRequest(uint8_t const * _payload, uint8_t _length);
+
+//send the pending report, main loop only
+unsigned char StackMonitor_Poll(void);
+
+#endif /* _STACK_MONITOR_H_ */
@@ -57,11 +57,28 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <drivers/i2c/adi_i2c.h>
 #include <services/pwr/adi_pwr.h>
 #include <services/gpio/adi_gpio.h>
+#include <services/trace/adi_trace.h>
 #include "common.h"
 #include "temperature_sensor.h"
 #include "BLE_Module.h"
 #include <string.h>
 #include "Communications.h"
+#include "sensor_sampler.h"
+#include "spsc_ring.h"
+#include "command_parser.h"
+#include "uart_handler.h"
+#include "transport.h"
+#include "packetizer.h"
+#include "deferred_log.h"
+#include "driver_stats.h"
+#include "latency_test.h"
+#include "isr_benchmark.h"
+#include "code_bench.h"
+#include "profiler.h"
+#include "stack_monitor.h"
+#include "ram_arena.h"
+#include "clock_governor.h"
+#include "idle_manager.h"
 
 
 #include "sps_device_580.h"
@@ -83,22 +100,63 @@ static uint8_t GPIOCallbackMem[ADI_GPIO_MEMORY_SIZE];
 static ADI_I2C_HANDLE masterDev;
 void Delay_ms(unsigned int mSec);
 
-volatile bool_t hbFlag = 0;
 
-void extInt0Callback(void *pCBParam, uint32_t Event, void *pArg)
+
+unsigned long   Msg_Count = 0;
+
+unsigned char   BLE_UID[TRANSPORT_UID_LENGTH] = {0x00, 0xEE, 0xAD, 0x14, 0x51, 0xDE, 0x21, 0xD8, 0x91, 0x67, 0x8A, 0xCF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00};
+
+extern uint8_t ble_code;
+
+/* Network parameters set by the API_COMMANDS of uart_handler.h */
+#define UART_PREFIX_LENGTH  8           /* bytes of the PREFIX command */
+static UART_CONFIG_PARAMETERS uartConfig;
+static uint8_t uartHop;
+static uint16_t uartPanId = DEFAULT_PAN_ID;
+static uint8_t uartPrefix[UART_PREFIX_LENGTH];
+
+static void apiCmdHop(uint8_t const* pPayload, uint8_t length)
 {
-  *(bool_t*)pCBParam = true;
+    uartHop = pPayload[0];
 }
 
+static void apiCmdDtsn(uint8_t const* pPayload, uint8_t length)
+{
+    uartConfig.dtsn = pPayload[0];
+}
 
+static void apiCmdSensorNode(uint8_t const* pPayload, uint8_t length)
+{
+    uartConfig.sensor_node = pPayload[0];
+}
 
-char BLE_Payload[255];
-
-unsigned long   Msg_Count = 0;
+static void apiCmdPanId(uint8_t const* pPayload, uint8_t length)
+{
+    uartPanId = ((uint16_t)pPayload[0] << 8) | pPayload[1];
+}
 
-unsigned char   BLE_UID[20] = {0x00, 0xEE, 0xAD, 0x14, 0x51, 0xDE, 0x21, 0xD8, 0x91, 0x67, 0x8A, 0xCF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00};
+static void apiCmdPrefix(uint8_t const* pPayload, uint8_t length)
+{
+    memcpy(uartPrefix, pPayload, UART_PREFIX_LENGTH);
+}
 
-extern uint8_t ble_code;
+/* Frames from the host, dispatched from the UART interrupt */
+static CMD_PARSER HostParser;
+static CMD_ENTRY const HostCommands[CMD_TABLE_SIZE] =
+{
+    { NULL, 0, 0 },
+    { apiCmdHop, 1, 1 },                /* HOP */
+    { apiCmdDtsn, 1, 1 },               /* DTSN */
+    { apiCmdSensorNode, 1, 1 },         /* SENSOR_NODE */
+    { apiCmdPanId, 2, 2 },              /* PAN_ID */
+    { apiCmdPrefix, UART_PREFIX_LENGTH, UART_PREFIX_LENGTH },   /* PREFIX */
+    { NULL, 0, 0 },                     /* UART_READ_COMPLETE_STATE */
+    { NULL, 0, 0 },
+    STACK_MONITOR_REQUEST_ENTRY,        /* STACK_MONITOR_REQUEST_ID */
+    PROFILER_REQUEST_ENTRY,             /* PROFILER_REQUEST_ID */
+    DRIVER_STATS_REQUEST_ENTRY,         /* DRIVER_STATS_REQUEST_ID */
+    TRANSPORT_ACK_ENTRY,                /* TRANSPORT_ACK_ID */
+};
 
 void adsAPI_Delay(uint32_t value)  {while(value--);}
 
@@ -109,14 +167,20 @@ void adsAPI_Delay(uint32_t value)  {while(value--);}
 //==============================================================================
 // General delay code. Delays approx. in mSec.
 //==============================================================================
+/* 3400 empty loops per ms at 26MHz, scaled to the clock governor level */
 void Delay_ms(unsigned int mSec)
 {
   int d1, d2;
+  uint32_t hclk = 26000000u;
+  uint32_t loops;
+  
+  adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &hclk);
+  loops = (3400u * (hclk / 100000u)) / 260u;//100kHz steps, 6.5MHz stays exact
   d1 = mSec;
   d2 = mSec;
   for ( d1 = 0; d1 < mSec; d1++ )
   {
-   for ( d2 = 0; d2 < 3400; d2++ )
+   for ( d2 = 0; d2 < loops; d2++ )
    {
    }
   }
@@ -131,10 +195,217 @@ void Delay_ms(unsigned int mSec)
 
 
     ///////////////////////////FOR TEST PURPOSE//////////////////////////////////////////////////////////
+/* Register addresses and results of the per-sample sensor poll */
+static uint8_t PollRegs[2] = {ID_REG, TEMPREG_MSB};
+static uint8_t DevID;
+static uint8_t TempRegs[2];
+
+/* The whole sensor poll is submitted to the I2C driver as one transaction list */
+static ADI_I2C_TRANSACTION PollList[] =
+{
+    /* Tx buffer     Rx buffer     slave address  Tx  Rx  restart */
+    { &PollRegs[0],  &DevID,       TARGETADDR,    1u, 1u, true },
+    { &PollRegs[1],  &TempRegs[0], TARGETADDR,    1u, 2u, true }
+};
+
+/* Bus speed in use, set again when the clock governor changes PCLK */
+static uint32_t BusSpeed = I2C_BUS_SPEED;
+
+/* SCL timing minimums per bus speed, from the I2C-bus specification */
+typedef struct
+{
+    uint16_t nBitRate;   /* kHz */
+    uint16_t nLowMin;    /* tLOW minimum in ns */
+    uint16_t nHighMin;   /* tHIGH minimum in ns */
+} I2C_BUS_TIMING;
+
+static const I2C_BUS_TIMING BusTimings[I2C_SPEED_COUNT] =
+{
+    /* kHz    tLOW   tHIGH */
+    {  100u, 4700u, 4000u },   /* standard mode */
+    {  400u, 1300u,  600u },   /* fast mode */
+    { 1000u,  500u,  260u }    /* fast mode plus */
+};
+
+/*
+ * Program the bit rate and duty cycle for one of the I2C_SPEED_xxx modes.
+ * The duty cycle gives SCL low and high their minimum times at the current
+ * PCLK and splits the remaining cycles evenly. Fails if PCLK is too slow to
+ * meet both minimums. The device must be disabled (no transfer running).
+ */
+static ADI_I2C_RESULT SetBusSpeed(uint32_t nSpeed)
+{
+    I2C_BUS_TIMING const *pTiming = &BusTimings[nSpeed];
+    ADI_I2C_RESULT eResult;
+    uint32_t pclk;
+    uint32_t period;
+    uint32_t low;
+    uint32_t high;
+    uint32_t duty;
+
+    if(ADI_PWR_SUCCESS != adi_pwr_GetClockFrequency(ADI_CLOCK_PCLK, &pclk))
+    {
+        return ADI_I2C_FAILURE;
+    }
+
+    /* SCL period and minimum low/high times in PCLK cycles (rounded up) */
+    period = pclk / ((uint32_t)pTiming->nBitRate * 1000u);
+    low    = ((pclk / 1000u) * pTiming->nLowMin  + 999999u) / 1000000u;
+    high   = ((pclk / 1000u) * pTiming->nHighMin + 999999u) / 1000000u;
+
+    if((low + high) > period)
+    {
+        DEBUG_MESSAGE("I2C %u kHz not reachable from PCLK\n", pTiming->nBitRate);
+        return ADI_I2C_BAD_BITRATE;
+    }
+
+    duty = ((high + (period - low - high) / 2u) * 100u) / period;
+
+    /* The driver truncates the high count, make sure the minimum still holds */
+    if(((period * duty) / 100u) < high)
+    {
+        duty++;
+    }
+
+    if(ADI_I2C_SUCCESS != (eResult = adi_i2c_SetBitRate(masterDev, pTiming->nBitRate)))
+    {
+        return eResult;
+    }
+
+    if(ADI_I2C_SUCCESS != (eResult = adi_i2c_SetDutyCycle(masterDev, (uint16_t)duty)))
+    {
+        return eResult;
+    }
+
+    BusSpeed = nSpeed;
+    return ADI_I2C_SUCCESS;
+}
+
+/*
+ * Clock governor listener, program the bus speed again from the new PCLK.
+ * The main loop blocking reads are done when the level changes, the sampler
+ * keeps its reads off the bus with its own listener.
+ */
+static void I2cClockChange(void *pCBParam, uint32_t Event, void *pArg)
+{
+    if(Event == CLOCK_GOV_EVENT_POST_CHANGE)
+    {
+        SetBusSpeed(BusSpeed);
+    }
+}
+
+/*
+ * Average the raw temperature of the good samples of a batch, also timed by
+ * the code placement benchmark
+ */
+ADI_ISRAM_CODE
+int16_t BatchTemperature(SAMPLER_SAMPLE const *pBatch)
+{
+    int32_t sum = 0;
+    int32_t count = 0;
+    uint32_t i;
+
+    for (i = 0u; i < SAMPLER_BATCH_SIZE; i++)
+    {
+        if (pBatch[i].Status == 0u)
+        {
+            /* discard the 3 bit flag at the LSB */
+            sum += ((int16_t)((uint16_t)pBatch[i].Data[0] << 8u) | (uint16_t)pBatch[i].Data[1]) >> 3u;
+            count++;
+        }
+    }
+
+    return (count != 0) ? (int16_t)(sum / count) : 0;
+}
+
+#if (SENSOR_SAMPLING_ENABLE == 1)
+/* Batches of temperature samples handed over by the sampler, room for all of its blocks */
+static SAMPLER_SAMPLE const *TempBatchMem[SAMPLER_BATCHES];
+static SPSC_RING TempBatches;
+
+/*
+ * Sampler batch notification, called from interrupt context
+ */
+static void TempBatchCallback(SAMPLER_SAMPLE const *pBatch, uint32_t nCount)
+{
+    if(SpscRing_Push(&TempBatches, &pBatch) != 0)
+    {
+        Sampler_ReleaseBatch(pBatch);
+    }
+    Idle_Wake();
+}
+#endif
+
+/*
+ * Low power wait of _ms, or until Idle_Wake with IDLE_FOREVER. The transport
+ * resends and the packetizer age flushes keep falling due meanwhile, the wait
+ * wakes for them and serves them at full speed. Returns 1 after an Idle_Wake.
+ */
+static unsigned char ServicedWait(uint32_t _ms)
+{
+    uint32_t end = ClockGov_Cycles() + (_ms * (CLOCK_GOV_ROOT_HZ / 1000u));
+    uint32_t wait, left;
+
+    while(1)
+    {
+        wait = Transport_NextTimeout();
+        if(Packetizer_NextFlush() < wait)
+        {
+            wait = Packetizer_NextFlush();
+        }
+        if(_ms != IDLE_FOREVER)
+        {
+            left = ClockGov_MsUntil(end);
+            if(left == 0u)
+            {
+                return 0;
+            }
+            if(left < wait)
+            {
+                wait = left;
+            }
+        }
+
+        if(Idle_Wait(wait) != 0)
+        {
+            return 1;
+        }
+
+        if((Transport_NextTimeout() == 0u) || (Packetizer_NextFlush() == 0u))
+        {
+            ClockGov_Hold(CLOCK_GOV_LEVEL_HIGH);
+            Transport_Poll();
+            Packetizer_Poll();
+            ClockGov_Release(CLOCK_GOV_LEVEL_HIGH);
+        }
+    }
+}
+
+#if (I2C_BENCHMARK_ENABLE == 1)
+/*
+ * Read one or more consecutive ADT7420 registers. The register address write,
+ * repeated start and read are done as a single driver operation.
+ */
+static ADI_I2C_RESULT ReadRegister(uint8_t reg, uint8_t *value, uint32_t size)
+{
+    uint8_t WriteBuffer[1];
+    ADI_I2C_RESULT eResult;
+
+    /* write register address */
+    WriteBuffer[0] = reg;
+
+    if(ADI_I2C_SUCCESS != (eResult = adi_i2c_WriteRead(masterDev, WriteBuffer, 1u, value, size)))
+    {
+        DEBUG_MESSAGE("adi_i2c_WriteRead failed\n");
+    }
+
+    return eResult;
+}
+
 /*                                                                                                    /// 
- * Read a ADT7420 register value                                                                      /// 
+ * Read a ADT7420 register value with the submit/enable/get buffer sequence                           /// 
  */                                                                                                   /// 
-static ADI_I2C_RESULT ReadRegister(uint8_t reg, uint8_t *value)                                       /// 
+static ADI_I2C_RESULT ReadRegisterSequence(uint8_t reg, uint8_t *value)                               /// 
 {                                                                                                     /// 
     uint8_t WriteBHuffer[1];                                                                          /// 
     ADI_I2C_RESULT eResult=ADI_I2C_SUCCESS;                                                           /// 
@@ -179,6 +450,103 @@ static ADI_I2C_RESULT ReadRegister(uint8_t reg, uint8_t *value)
                                                                                                       ///
     return eResult;                                                                                   ///
 }                                                                                                     ///
+
+/*
+ * Compare the CPU cycles spent per register read by the buffer sequence and
+ * by adi_i2c_WriteRead, using the DWT cycle counter.
+ */
+static void BenchmarkReadRegister(void)
+{
+    uint32_t i;
+    uint32_t start;
+    uint32_t seqCycles;
+    uint32_t regCycles;
+    uint8_t  value;
+
+    /* Enable the cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    start = DWT->CYCCNT;
+    for (i = 0u; i < I2C_BENCHMARK_RUNS; i++)
+    {
+        ReadRegisterSequence(ID_REG, &value);
+    }
+    seqCycles = (DWT->CYCCNT - start) / I2C_BENCHMARK_RUNS;
+
+    start = DWT->CYCCNT;
+    for (i = 0u; i < I2C_BENCHMARK_RUNS; i++)
+    {
+        ReadRegister(ID_REG, &value, 1u);
+    }
+    regCycles = (DWT->CYCCNT - start) / I2C_BENCHMARK_RUNS;
+
+    DEBUG_MESSAGE("I2C register read: sequence %lu cycles, WriteRead %lu cycles\n",
+                  (unsigned long)seqCycles, (unsigned long)regCycles);
+}
+
+/*
+ * Run the sensor poll at every bus speed and report the transactions per
+ * second and the number of failed polls. A poll fails if the driver reports
+ * an error or the ID register does not read back as TEST_VALUE.
+ */
+static void BenchmarkBusSpeeds(void)
+{
+    uint32_t nSpeed;
+    uint32_t i;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t errors;
+    uint32_t hclk;
+    ADI_I2C_RESULT eResult;
+
+    if(ADI_PWR_SUCCESS != adi_pwr_GetClockFrequency(ADI_CLOCK_HCLK, &hclk))
+    {
+        DEBUG_MESSAGE("Failed to get HCLK frequency\n");
+        return;
+    }
+
+    for (nSpeed = 0u; nSpeed < I2C_SPEED_COUNT; nSpeed++)
+    {
+        if(ADI_I2C_SUCCESS != SetBusSpeed(nSpeed))
+        {
+            DEBUG_MESSAGE("I2C %u kHz: not supported\n", BusTimings[nSpeed].nBitRate);
+            continue;
+        }
+
+        errors = 0u;
+        start  = DWT->CYCCNT;
+        for (i = 0u; i < I2C_BENCHMARK_POLLS; i++)
+        {
+            DevID = 0u;
+            eResult = adi_i2c_SubmitTransactionList(masterDev, PollList,
+                                                    sizeof(PollList) / sizeof(PollList[0]));
+            if(ADI_I2C_SUCCESS == eResult)
+            {
+                eResult = adi_i2c_GetTransactionListResult(masterDev, NULL);
+            }
+            if((ADI_I2C_SUCCESS != eResult) || (TEST_VALUE != DevID))
+            {
+                errors++;
+            }
+        }
+        /* Cycles per poll, each poll is one transaction per list entry */
+        cycles = (DWT->CYCCNT - start) / I2C_BENCHMARK_POLLS;
+
+        DEBUG_MESSAGE("I2C %u kHz: %lu transactions/s, %lu/%lu polls failed\n",
+                      BusTimings[nSpeed].nBitRate,
+                      (unsigned long)((hclk / cycles) * (sizeof(PollList) / sizeof(PollList[0]))),
+                      (unsigned long)errors, (unsigned long)I2C_BENCHMARK_POLLS);
+    }
+
+    /* Back to the application bus speed */
+    if(ADI_I2C_SUCCESS != SetBusSpeed(I2C_BUS_SPEED))
+    {
+        DEBUG_MESSAGE("Failed to restore the I2C bus speed\n");
+    }
+}
+#endif
     ///////////////////////////END OF TEMPERATURE TEST///////////////////////////////////////////////////
 /*                                                                                                    
  * main                                                                                               
@@ -186,11 +554,18 @@ static ADI_I2C_RESULT ReadRegister(uint8_t reg, uint8_t *value)
 int main(void)
 {
     ADI_I2C_RESULT eResult=ADI_I2C_SUCCESS;
-    uint8_t DevID;///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
-    uint8_t t_msb, t_lsb;///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
     int16_t Temp;///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
-    float ctemp, ftemp;///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
+    int32_t ctemp, ftemp;///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
     uint8_t deviceMemory[ADI_I2C_MEMORY_SIZE];///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
+    uint8_t Sample[2];
+    uint32_t nLoops = 0u;
+#if (SENSOR_SAMPLING_ENABLE == 1)
+    SAMPLER_SAMPLE const *pTempBatch;
+    uint32_t nOverruns = 0u, nSkipped;
+#endif
+    
+    /* Paint the free stack for the high-water mark */
+    StackMonitor_Paint();
     
     /* Clock initialization */
     SystemInit();
@@ -207,28 +582,42 @@ int main(void)
         eResult = ADI_I2C_FAILURE; 
     }
     
-    if(ADI_PWR_SUCCESS != adi_pwr_SetClockDivider(ADI_CLOCK_HCLK,1))
+    /* Full speed for the boot, the main loop drops it while it waits */
+    if(ClockGov_Init(CLOCK_GOV_LEVEL_HIGH) != 0)
     {
-        DEBUG_MESSAGE("Failed to set clock divider for HCLK\n");
+        DEBUG_MESSAGE("Failed to set the clock dividers\n");
     }
-     
-    if(ADI_PWR_SUCCESS != adi_pwr_SetClockDivider(ADI_CLOCK_PCLK,1))
-    {
-        DEBUG_MESSAGE("Failed to set clock divider for PCLK\n");
-    }  
+    ClockGov_Hold(CLOCK_GOV_LEVEL_HIGH);
+    
+#if (ADI_CFG_ENABLE_TRACE == 1)
+    /* Trace the rest of the boot, HCLK is final from here */
+    adi_trace_Start();
+#endif
     
     if(adi_gpio_Init(GPIOCallbackMem, ADI_GPIO_MEMORY_SIZE)!= ADI_GPIO_SUCCESS)
     {
       DEBUG_MESSAGE("Failed to initialize GPIO\n");
     }
     
+    /* Before the peripherals are opened, the wake-up latencies are measured in hibernate */
+    if(Idle_Init() != 0)
+    {
+        DEBUG_MESSAGE("RTC1 does not count, the waits will not sleep\n");
+    }
+    
     //Enable GPIO's
     adi_gpio_OutputEnable(ADI_GPIO_PORT0, (ADI_GPIO_PIN_4 | ADI_GPIO_PIN_5), true);//I2C to ADT7400///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
     
     //BOOT BLE MODULE
+    ADI_TRACE(ADI_TRACE_APP_BEGIN, TRACE_PHASE_BLE_BOOT);
     if(Ble_Spi_Boot(BLE_BINARY, IMAGE_SIZE) != 0)
     DEBUG_MESSAGE("Dialog14580 failed to boot\n");
+    ADI_TRACE(ADI_TRACE_APP_END, TRACE_PHASE_BLE_BOOT);
     
+    /* The boot buffers are done with, the link buffers reuse their RAM */
+    Arena_Enter(ARENA_PHASE_RUN);
+    
+    ADI_TRACE(ADI_TRACE_APP_BEGIN, TRACE_PHASE_I2C_INIT);
     ///////////////////////////FOR TEST PURPOSE///////////////////////////////////////
     /* I2C INIT */                                                                 ///
                                                                                    ///
@@ -239,11 +628,8 @@ int main(void)
                           &masterDev);                                             ///
     DEBUG_RESULT("adi_i2c_Open failed\n",eResult,ADI_I2C_SUCCESS);                 ///
                                                                                    ///
-    eResult = adi_i2c_SetBitRate(masterDev, BITRATE);                              ///
-    DEBUG_RESULT("adi_i2c_SetBitRate failed\n",eResult,ADI_I2C_SUCCESS);           ///
-                                                                                   ///
-    eResult = adi_i2c_SetDutyCycle(masterDev, DUTYCYCLE);                          ///
-    DEBUG_RESULT("adi_i2c_SetDutyCycle failed\n",eResult,ADI_I2C_SUCCESS);         ///
+    eResult = SetBusSpeed(I2C_BUS_SPEED);                                          ///
+    DEBUG_RESULT("SetBusSpeed failed\n",eResult,ADI_I2C_SUCCESS);                  ///
                                                                                    ///
                                                                                    ///
     /* Set hardware address width */                                               ///
@@ -254,43 +640,159 @@ int main(void)
     eResult = adi_i2c_SetHardwareAddress(masterDev, TARGETADDR);                   ///
     DEBUG_RESULT("adi_i2c_SetHardwareAddress failed\n",eResult,ADI_I2C_SUCCESS);   ///
                                                                                    ///
+    if(ClockGov_Register(I2cClockChange, NULL) != 0)                               ///
+    {                                                                              ///
+        DEBUG_MESSAGE("Failed to follow the clock changes on I2C\n");              ///
+    }                                                                              ///
+                                                                                   ///
     ///////////////////////////END OF TEMPERATURE TEST////////////////////////////////
+    ADI_TRACE(ADI_TRACE_APP_END, TRACE_PHASE_I2C_INIT);
+    
+#if (I2C_BENCHMARK_ENABLE == 1)
+    BenchmarkReadRegister();
+    BenchmarkBusSpeeds();
+#endif
     
+#if (LATENCY_TEST_ENABLE == 1)
+    LatencyTest_Run();
+#endif
+    
+#if (ISR_BENCHMARK_ENABLE == 1)
+    /* Before Uart_Init, the benchmark borrows UART0 */
+    IsrBenchmark_Run(masterDev, TARGETADDR, ID_REG);
+#endif
+    
+#if (CODE_BENCH_ENABLE == 1)
+    /* Before Uart_Init as well, the handlers are timed by the ISR benchmark */
+    CodeBench_Run(masterDev, TARGETADDR, ID_REG);
+#endif
+    
+#if (SENSOR_SAMPLING_ENABLE == 1)
+    SpscRing_Init(&TempBatches, TempBatchMem, sizeof(TempBatchMem[0]),
+                  sizeof(TempBatchMem) / sizeof(TempBatchMem[0]));
+    if(Sampler_Start(masterDev, TARGETADDR, TEMPREG_MSB, SENSOR_SAMPLE_PERIOD_US, TempBatchCallback) != 0)
+    {
+        DEBUG_MESSAGE("Failed to start the temperature sampling\n");
+    }
+#endif
+    
+    ADI_TRACE(ADI_TRACE_APP_BEGIN, TRACE_PHASE_LINK);
     Uart_Init();
     
+    /* Coalesce the outgoing frames into full BLE notifications */
+    if(Packetizer_Init(PKT_DEFAULT_AGE_MS) != 0)
+    {
+        DEBUG_MESSAGE("Failed to start the packetizer\n");
+    }
+    
+    /* Log records are drained through the packetizer from the main loop */
+    DLog_Init();
+    
+    /* Take ACKs from the host and announce the device */
+    CmdParser_Init(&HostParser, HostCommands);
+    if(Uart_ReceiveStream(&HostParser) != 0)
+    {
+        DEBUG_MESSAGE("Failed to start the UART reception\n");
+    }
+    if(Transport_Init(BLE_UID) != 0)
+    {
+        DEBUG_MESSAGE("Failed to start the transport\n");
+    }
+#if (PROFILER_ENABLE == 1)
+    if(Profiler_Start(PROFILER_RATE_HZ) != 0)
+    {
+        DEBUG_MESSAGE("Failed to start the profiler\n");
+    }
+#endif
+    ADI_TRACE(ADI_TRACE_APP_END, TRACE_PHASE_LINK);
+    /* Reported over the link, DEBUG_MESSAGE has no console on a deployed board */
+    Packetizer_Printf("stack,peak,%u,%u\n",
+                      (unsigned int)StackMonitor_Peak(), (unsigned int)StackMonitor_Size());
+    Packetizer_Printf("arena,peak,%u,%u\n", (unsigned int)Arena_Peak(), ARENA_SIZE);
+    ClockGov_Release(CLOCK_GOV_LEVEL_HIGH);
+    
     while(1)
     {
+      ADI_TRACE(ADI_TRACE_APP_BEGIN, TRACE_PHASE_SAMPLE);
+      ClockGov_Hold(CLOCK_GOV_LEVEL_MID);
       ///////////////////////////FOR TEST PURPOSE///////////////////////////////////////////////////
+#if (SENSOR_SAMPLING_ENABLE == 1)                                                                ///
+      /* Drop the batches queued during the delay and wait for a fresh one */                    ///
+        while (SpscRing_Pop(&TempBatches, &pTempBatch) == 0)                                     ///
+        {                                                                                        ///
+            Sampler_ReleaseBatch(pTempBatch);                                                    ///
+        }                                                                                        ///
+        while (SpscRing_Pop(&TempBatches, &pTempBatch) != 0)                                     ///
+        {                                                                                        ///
+            ServicedWait(IDLE_FOREVER);                                                          ///
+        }                                                                                        ///
+        Temp = BatchTemperature(pTempBatch);                                                     ///
+        Sampler_ReleaseBatch(pTempBatch);                                                        ///
+#else                                                                                            ///
       DevID = 0u;                                                                                ///
-      eResult = ReadRegister(ID_REG, &DevID);                                                    ///
-      DEBUG_RESULT("Failed to read ID register",eResult,ADI_I2C_SUCCESS);                        ///
                                                                                                  ///
-      /* Read the temperature MSB register */                                                    ///
-        eResult = ReadRegister(TEMPREG_MSB, &t_msb);                                             ///
-        DEBUG_RESULT("Reading temperature MSB register failed",eResult,ADI_I2C_SUCCESS);         ///
-                                                                                                 ///
-        /* Read the temperature LSB register */                                                  ///
-        eResult = ReadRegister(TEMPREG_LSB, &t_lsb);                                             ///
-        DEBUG_RESULT("Reading temperature LSB register failed",eResult,ADI_I2C_SUCCESS);         ///
+      /* Read the ID and the temperature MSB/LSB registers in one submission */                  ///
+        eResult = adi_i2c_SubmitTransactionList(masterDev, PollList,                             ///
+                                                sizeof(PollList) / sizeof(PollList[0]));         ///
+        DEBUG_RESULT("adi_i2c_SubmitTransactionList failed",eResult,ADI_I2C_SUCCESS);            ///
+        eResult = adi_i2c_GetTransactionListResult(masterDev, NULL);                             ///
+        DEBUG_RESULT("Sensor poll failed",eResult,ADI_I2C_SUCCESS);                              ///
                                                                                                  ///
         /* Get the temperature by discarding the 3 bit flag at the LSB */                        ///
-        Temp = ((int16_t)((uint16_t)t_msb << 8u) | (uint16_t)t_lsb) >> 3u;                       ///
+        Temp = ((int16_t)((uint16_t)TempRegs[0] << 8u) | (uint16_t)TempRegs[1]) >> 3u;           ///
+#endif                                                                                           ///
                                                                                                  ///
                                                                                                  ///
-        /* convert raw to deg C */                                                               ///
-        ctemp = (Temp * 1.0)/16.0;                                                               ///
+        /* convert raw to 0.1 deg C */                                                           ///
+        ctemp = ((int32_t)Temp * 10) / 16;                                                       ///
                                                                                                  ///
-        /* convert raw to deg F */                                                               ///
-        ftemp = ctemp * (9.0/5.0) + 32.0;                                                        ///
+        /* convert raw to 0.1 deg F */                                                           ///
+        ftemp = ((ctemp * 9) / 5) + 320;                                                         ///
                                                                                                  ///
-        DEBUG_MESSAGE("Temperature: %5.1f deg C\n",ctemp);                                       ///
-        DEBUG_MESSAGE("Temperature: %5.1f deg F\n",ftemp);                                       ///
+        DLOG2(LOG_TEMPERATURE, ctemp, ftemp);                                                    ///
         ///////////////////////////END OF TEMPERATURE TEST//////////////////////////////////////////
         
         
-        sprintf(BLE_Payload, "Temperature is: %f\n", ctemp);
-        Uart_ReadWrite(BLE_Payload);
-        Delay_ms(500);
+        /* Raw temperature, MSB first. Not acknowledged yet is fine, the transport resends */
+        Sample[0] = (uint8_t)((uint16_t)Temp >> 8u);
+        Sample[1] = (uint8_t)Temp;
+        if(Transport_Send(Sample, sizeof(Sample)) == 0)
+        {
+            Msg_Count++;
+        }
+        else
+        {
+            DLOG1(LOG_TRANSPORT_FULL, Transport_InFlight());
+        }
+#if (SENSOR_SAMPLING_ENABLE == 1)
+        nSkipped = Sampler_GetOverruns() - nOverruns;
+        if(nSkipped != 0u)
+        {
+            DLOG1(LOG_SAMPLER_OVERRUNS, nSkipped);
+            nOverruns += nSkipped;
+        }
+#endif
+        if(++nLoops == CLOCK_REPORT_LOOPS)
+        {
+            DLOG3(LOG_CLOCK_RESIDENCY, ClockGov_Residency(CLOCK_GOV_LEVEL_LOW),
+                  ClockGov_Residency(CLOCK_GOV_LEVEL_MID), ClockGov_Residency(CLOCK_GOV_LEVEL_HIGH));
+            DLOG3(LOG_IDLE_RESIDENCY, Idle_Residency(IDLE_MODE_ACTIVE),
+                  Idle_Residency(IDLE_MODE_FLEXI), Idle_Residency(IDLE_MODE_HIBERNATE));
+            nLoops = 0u;
+        }
+        
+        /* Full speed while the frames go out, the wait runs at the lowest level */
+        ClockGov_Hold(CLOCK_GOV_LEVEL_HIGH);
+        Transport_Poll();
+        DriverStats_Poll();
+        Profiler_Poll();
+        StackMonitor_Poll();
+        DLog_Drain(DLOG_RING_SIZE);
+        Packetizer_Poll();
+        ClockGov_Release(CLOCK_GOV_LEVEL_HIGH);
+        ClockGov_Release(CLOCK_GOV_LEVEL_MID);
+        ADI_TRACE(ADI_TRACE_APP_END, TRACE_PHASE_SAMPLE);
+        ServicedWait(500);
         
     }
     
@@ -22,15 +22,41 @@ to the terms of the associated Analog Devices License Agreement.
 #define TARGETADDR    (0x48u)     /* TODO: hardware address for the Temperature Monitor (ADT7420) */
 
 #define TWIDEVNUM     (0u)        /* TWI device number */
-#define BITRATE       (100u)      /* kHz */
-#define DUTYCYCLE     (50u)       /* percent */
 #define PRESCALEVALUE (125u/10u)  /* fSCLK/10MHz */
 
+/* I2C bus speed modes, the SCL high/low split is computed from PCLK */
+#define I2C_SPEED_STANDARD  (0u)  /* 100 kHz */
+#define I2C_SPEED_FAST      (1u)  /* 400 kHz */
+#define I2C_SPEED_FAST_PLUS (2u)  /* 1 MHz, above the ADT7420 400 kHz rating */
+#define I2C_SPEED_COUNT     (3u)
+
+#define I2C_BUS_SPEED       I2C_SPEED_FAST  /* bus speed used by the application */
+
 #define TEMPREG_MSB   (0x0u)      /* temperature MSB register */
 #define TEMPREG_LSB   (0x1u)      /* temperature LSB register */
 #define ID_REG        (0x0Bu)     /* manufacture ID register */
 #define TEST_VALUE    (0xCBu)     /* expected value */
 
+#define SENSOR_SAMPLING_ENABLE  (0)       /* 1 to sample the temperature from a timer instead of polling */
+#define SENSOR_SAMPLE_PERIOD_US (10000u)  /* sampling period */
+
+#define I2C_BENCHMARK_ENABLE (0)    /* 1 to benchmark the I2C read methods and bus speeds at startup */
+#define I2C_BENCHMARK_RUNS   (100u) /* register reads per method */
+#define I2C_BENCHMARK_POLLS  (500u) /* sensor polls per bus speed */
+
+#define LATENCY_TEST_ENABLE  (0)    /* 1 to check the interrupt latency budgets at startup, see latency_test.h */
+#define ISR_BENCHMARK_ENABLE (0)    /* 1 to time the driver interrupt handlers at startup, see isr_benchmark.h */
+#define PROFILER_ENABLE      (0)    /* 1 to sample the program counter for tools/profile_symbolize.py, see profiler.h */
+#define CODE_BENCH_ENABLE    (0)    /* 1 to time the hot code from flash, cache and instruction SRAM at startup, see code_bench.h */
+
+#define CLOCK_REPORT_LOOPS   (120u) /* main loop passes between clock level and idle residency logs, about a minute */
+
+/* application phases in the event trace (ADI_CFG_ENABLE_TRACE in adi_global_config.h) */
+#define TRACE_PHASE_BLE_BOOT (1u)   /* BLE module image download */
+#define TRACE_PHASE_I2C_INIT (2u)   /* I2C master setup */
+#define TRACE_PHASE_LINK     (3u)   /* UART, packetizer and transport startup */
+#define TRACE_PHASE_SAMPLE   (4u)   /* one main loop pass: read, convert, send */
+
 
 /* Pin muxing */
 extern int32_t adi_initpinmux(void);
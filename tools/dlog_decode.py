@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Decode the deferred log frames of the temperature sensor.
+
+The firmware never formats its log messages (see deferred_log.h). It sends
+DLOG frames (SYNC 0x7E, ID 0x12, LENGTH, PAYLOAD) holding the log ID, the root
+clock cycle count of the clock governor and the raw 32 bit arguments. This tool
+rebuilds the text with the formats of log_messages.h, which must come from the
+same build as the image.
+
+Examples:
+    dlog_decode.py capture.bin
+    dlog_decode.py --port /dev/ttyUSB0
+    dlog_decode.py --table                # print the string table as JSON
+
+TEXT frames (ID 0x16) of Packetizer_Printf are printed as they are, without a
+time. Other frames of the stream (transport HELLO/DATA) are skipped.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+FRAME_SYNC = 0x7E
+DLOG_FRAME_ID = 0x12
+TEXT_FRAME_ID = 0x16
+RECORD_HEADER = struct.Struct(">HI")
+
+DEFAULT_TABLE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             "..", "log_messages.h")
+
+MESSAGE_RE = re.compile(r'^\s*LOG_MESSAGE\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)',
+                        re.MULTILINE)
+SPEC_RE = re.compile(r"%(0?)(\d*)(?:\.(\d+))?[lh]*([diukxXc%])")
+
+
+def load_table(path):
+    """Return [(name, format)] in log ID order."""
+    with open(path, "r") as f:
+        text = f.read()
+    table = []
+    for name, fmt in MESSAGE_RE.findall(text):
+        table.append((name, bytes(fmt, "ascii").decode("unicode_escape")))
+    return table
+
+
+def signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_record(fmt, args):
+    """Python mirror of test_VFormat() for the raw argument words."""
+    args = list(args)
+
+    def convert(m):
+        zero, width, decimals, conv = m.groups()
+        if conv == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        width = int(width) if width else 0
+        if conv == "c":
+            return chr(value & 0xFF)
+        if conv == "x":
+            text = "%x" % value
+        elif conv == "X":
+            text = "%X" % value
+        elif conv == "u":
+            text = "%u" % value
+        else:
+            value = signed(value)
+            decimals = int(decimals) if (conv == "k" and decimals) else 0
+            digits = "%0*u" % (decimals + 1, abs(value))
+            if decimals:
+                digits = digits[:-decimals] + "." + digits[-decimals:]
+            text = ("-" if value < 0 else "") + digits
+        if zero and text.startswith("-"):
+            return "-" + text[1:].rjust(width - 1, "0")
+        return text.rjust(width, "0" if zero else " ")
+
+    return SPEC_RE.sub(convert, fmt)
+
+
+def frames(stream, live=False):
+    """Yield (id, payload) for every complete frame, resynchronising on SYNC."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if live:
+                continue
+            return
+        buf += chunk
+        while True:
+            start = buf.find(FRAME_SYNC)
+            if start < 0:
+                del buf[:]
+                break
+            del buf[:start]
+            if len(buf) < 3 or len(buf) < 3 + buf[2]:
+                break
+            frame_id, length = buf[1], buf[2]
+            yield frame_id, bytes(buf[3:3 + length])
+            del buf[:3 + length]
+
+
+def decode(stream, table, clock_hz, out, live=False):
+    first = None
+    last = None
+    wraps = 0
+    for frame_id, payload in frames(stream, live):
+        if frame_id == TEXT_FRAME_ID:
+            out.write("%12s %-22s %s\n" % ("", "TEXT", payload.decode("ascii", "replace").rstrip("\n")))
+            out.flush()
+            continue
+        if frame_id != DLOG_FRAME_ID or len(payload) < RECORD_HEADER.size:
+            continue
+        log_id, cycles = RECORD_HEADER.unpack_from(payload)
+        count = (len(payload) - RECORD_HEADER.size) // 4
+        args = struct.unpack_from(">%dI" % count, payload, RECORD_HEADER.size)
+
+        # extend the 32 bit cycle counter, it wraps every 2^32 / clock seconds
+        if last is not None and cycles < last:
+            wraps += 1
+        last = cycles
+        cycles += wraps << 32
+        if first is None:
+            first = cycles
+        seconds = (cycles - first) / float(clock_hz)
+
+        if log_id < len(table):
+            name, fmt = table[log_id]
+            text = format_record(fmt, args)
+        else:
+            name = "LOG_%u" % log_id
+            text = "unknown log ID, args " + " ".join("0x%08X" % a for a in args)
+        out.write("%12.6f %-22s %s\n" % (seconds, name, text))
+        out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="raw UART capture, default stdin")
+    parser.add_argument("--messages", default=DEFAULT_TABLE,
+                        help="log_messages.h of the running build")
+    parser.add_argument("--port", help="read from a serial port (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--clock", type=float, default=26e6,
+                        help="root clock in Hz (CLOCK_GOV_ROOT_HZ), converts the cycle counts to seconds")
+    parser.add_argument("--table", action="store_true",
+                        help="print the string table as JSON and exit")
+    opts = parser.parse_args()
+
+    table = load_table(opts.messages)
+    if opts.table:
+        json.dump([{"id": i, "name": n, "format": f} for i, (n, f) in enumerate(table)],
+                  sys.stdout, indent=2)
+        sys.stdout.write("\n")
+        return 0
+
+    if opts.port:
+        import serial
+        stream = serial.Serial(opts.port, opts.baud, timeout=0.1)
+    elif opts.capture:
+        stream = open(opts.capture, "rb")
+    else:
+        stream = sys.stdin.buffer
+
+    try:
+        decode(stream, table, opts.clock, sys.stdout, live=bool(opts.port))
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
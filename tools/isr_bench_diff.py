@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Tabulate and compare interrupt handler benchmark captures.
+
+Reads the "isrbench," lines printed by isr_benchmark.c (ISR_BENCHMARK_ENABLE in
+temperature_sensor.h) from a terminal capture; other lines are ignored. With
+one capture the results are printed, with two the second is compared against
+the first and the exit status is 1 if any handler got slower than the
+threshold or a workload failed.
+
+Captures of the code placement benchmark (CODE_BENCH_ENABLE, code_bench.h)
+work too: the directly timed functions are listed under handler "-" and every
+workload is suffixed with the cache setting it ran under, so a flash build
+capture compared against an ISRAM build capture shows both cache settings.
+
+Examples:
+    isr_bench_diff.py capture.txt
+    isr_bench_diff.py baseline.txt capture.txt --threshold 5
+    isr_bench_diff.py capture.txt --json > results.json
+    isr_bench_diff.py flash_build.txt isram_build.txt
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DEVICE_HEADER = os.path.join(ROOT, "inc", "ADuCM302x_device.h")
+FIELDS = ("calls", "min", "avg", "max")
+DIRECT = -1  # irq of the functions called directly by the code placement benchmark
+
+
+def load_irqs(path):
+    with open(path) as f:
+        return {int(irq): name for name, irq in
+                re.findall(r"^\s*(\w+)_IRQn\s*=\s*(\d+)", f.read(), re.M)}
+
+
+def load_capture(path):
+    """Return hclk, {(workload, irq): {field: cycles}}, [failed workloads].
+
+    Functions timed by the code placement benchmark get irq DIRECT."""
+    hclk, results, failed = None, {}, []
+    suffix = ""
+    with open(path, errors="replace") as f:
+        for line in f:
+            fields = line.strip().split(",")
+            if len(fields) < 3 or fields[0] not in ("isrbench", "codebench"):
+                continue
+            if fields[1] == "hclk":
+                hclk = int(fields[2])
+            elif fields[0] == "codebench":
+                if fields[1] == "cache":
+                    suffix = "/" + fields[2]
+                elif len(fields) == 7 and fields[3].isdigit():
+                    results[(fields[1] + "/" + fields[2], DIRECT)] = dict(zip(FIELDS, map(int, fields[3:])))
+            elif fields[2] == "failed":
+                failed.append(fields[1] + suffix)
+            elif len(fields) == 7 and fields[2].isdigit():
+                results[(fields[1] + suffix, int(fields[2]))] = dict(zip(FIELDS, map(int, fields[3:])))
+    return hclk, results, failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("captures", nargs="+", metavar="capture", help="baseline first when comparing")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed growth of the avg and max cycles, in percent")
+    parser.add_argument("--json", action="store_true", help="print the last capture as JSON")
+    opts = parser.parse_args()
+    if len(opts.captures) > 2:
+        parser.error("at most two captures")
+
+    irqs = load_irqs(DEVICE_HEADER)
+    hclk, results, failed = load_capture(opts.captures[-1])
+    name = lambda irq: "-" if irq == DIRECT else irqs.get(irq, "IRQ%u" % irq)
+
+    if opts.json:
+        json.dump({"hclk": hclk, "failed": failed,
+                   "results": [dict(workload=w, irq=i, handler=name(i), **r)
+                               for (w, i), r in sorted(results.items())]}, sys.stdout, indent=1)
+        print()
+        return 1 if failed else 0
+
+    for workload in failed:
+        print("%-28s FAILED" % workload)
+
+    if len(opts.captures) == 1:
+        for (workload, irq), r in sorted(results.items()):
+            print("%-28s %-22s calls %6u  min %7u  avg %7u  max %7u" % (
+                workload, name(irq), r["calls"], r["min"], r["avg"], r["max"]))
+        return 1 if failed else 0
+
+    base_hclk, base, _ = load_capture(opts.captures[0])
+    if base_hclk != hclk:
+        print("warning: HCLK %s Hz against %s Hz, cycles are not comparable" % (hclk, base_hclk))
+
+    regressions = 0
+    for key in sorted(set(base) | set(results)):
+        workload, irq = key
+        old, new = base.get(key), results.get(key)
+        if old is None or new is None:
+            print("%-28s %-22s %s" % (workload, name(irq), "new" if old is None else "gone"))
+            continue
+        growth = [(new[f] - old[f]) * 100.0 / old[f] if old[f] else 0.0 for f in ("avg", "max")]
+        worse = any(g > opts.threshold for g in growth)
+        regressions += worse
+        print("%-28s %-22s avg %7u -> %7u (%+6.1f%%)  max %7u -> %7u (%+6.1f%%)%s" % (
+            workload, name(irq), old["avg"], new["avg"], growth[0],
+            old["max"], new["max"], growth[1], "  REGRESSION" if worse else ""))
+
+    return 1 if (regressions or failed) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
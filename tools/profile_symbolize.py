@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Fetch the sampling profiler histogram and attribute it to functions.
+
+Sends a profiler REQUEST frame (see profiler.h, PROFILER_ENABLE in
+temperature_sensor.h) and maps the program counter histogram to the functions
+of the linked image, from the ELF output (with nm) or the IAR linker map. A
+bucket is charged to the function holding its first byte, so functions
+shorter than a bucket (1 << PROFILER_BUCKET_SHIFT bytes) can share counts with
+their neighbours.
+
+Examples:
+    profile_symbolize.py --port /dev/ttyUSB0 --elf temperature_sensor.out
+    profile_symbolize.py --port /dev/ttyUSB0 --reset --save profile.json
+    profile_symbolize.py --load profile.json --map temperature_sensor.map --top 40
+"""
+
+import argparse
+import bisect
+import json
+import re
+import struct
+import subprocess
+import sys
+
+import serial
+
+from stats_query import FRAME_SYNC, frames
+
+REQUEST_ID = 9
+REPORT_ID = 0x14
+FLAG_RESET = 0x01
+
+SECTION_INFO = 0
+SECTION_DATA = 1
+SECTION_END = 0xFF
+
+
+def request(port, reset, timeout):
+    """Return the report as a dict, None if no END frame came back."""
+    port.write(bytes([FRAME_SYNC, REQUEST_ID, 1, FLAG_RESET if reset else 0]))
+    profile = {"counts": {}}
+    for frame_id, payload in frames(port, timeout):
+        if frame_id != REPORT_ID or not payload:
+            continue
+        if payload[0] == SECTION_INFO and len(payload) == 10:
+            profile["base"], profile["shift"], profile["buckets"], profile["rate"] = \
+                struct.unpack(">IBHH", payload[1:])
+        elif payload[0] == SECTION_DATA:
+            for index, count in struct.iter_unpack(">HH", payload[1:1 + (len(payload) - 1) // 4 * 4]):
+                profile["counts"][index] = profile["counts"].get(index, 0) + count
+        elif payload[0] == SECTION_END and len(payload) == 9:
+            profile["samples"], profile["outside"] = struct.unpack(">II", payload[1:])
+            return profile if "base" in profile else None
+    return None
+
+
+def nm_symbols(elf, nm):
+    """[(address, size, name)] of the functions of an ELF file."""
+    out = subprocess.run([nm, "-n", "-S", "--defined-only", elf], check=True,
+                         stdout=subprocess.PIPE, universal_newlines=True).stdout
+    symbols = []
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[2] in "TtWw":
+            symbols.append((int(fields[0], 16) & ~1, int(fields[1], 16), fields[3]))
+    return symbols
+
+
+def map_symbols(path):
+    """[(address, size, name)] of the Code entries of an IAR linker map."""
+    with open(path, errors="replace") as f:
+        text = f.read().replace("'", "")
+    # Long names put the address on the next line
+    entry = re.compile(r"^\s*([A-Za-z_$?][\w$?.:~<>]*)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+Code\b", re.M)
+    return [(int(addr, 16) & ~1, int(size, 16), name)
+            for name, addr, size in entry.findall(re.sub(r"\n(?=\s+0x)", " ", text))]
+
+
+def attribute(profile, symbols):
+    """{function: samples} for the buckets of the profile."""
+    symbols = sorted(set(symbols))
+    starts = [s[0] for s in symbols]
+    totals = {}
+    for index, count in profile["counts"].items():
+        address = profile["base"] + (int(index) << profile["shift"])
+        i = bisect.bisect_right(starts, address) - 1
+        name = "(unknown)"
+        if i >= 0:
+            start, size, symbol = symbols[i]
+            if size == 0 or address < start + size:
+                name = symbol
+        totals[name] = totals.get(name, 0) + count
+    if profile["outside"]:
+        totals["(outside the histogram)"] = profile["outside"]
+    return totals
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial port of the device")
+    source.add_argument("--load", metavar="JSON", help="histogram saved with --save")
+    image = parser.add_mutually_exclusive_group()
+    image.add_argument("--elf", help="linked image, symbolised with --nm")
+    image.add_argument("--map", help="IAR linker map file")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--reset", action="store_true", help="restart the histogram after reading")
+    parser.add_argument("--save", metavar="JSON", help="also write the histogram to a file")
+    parser.add_argument("--top", type=int, default=20, help="functions to print, 0 for all")
+    parser.add_argument("--timeout", type=float, default=2.0)
+    opts = parser.parse_args()
+
+    if opts.port:
+        profile = request(serial.Serial(opts.port, opts.baud, timeout=0.1), opts.reset, opts.timeout)
+        if profile is None:
+            sys.stderr.write("no complete report, is the profiler running?\n")
+            return 1
+    else:
+        with open(opts.load) as f:
+            profile = json.load(f)
+        profile["counts"] = {int(i): c for i, c in profile["counts"].items()}
+
+    if opts.save:
+        with open(opts.save, "w") as f:
+            json.dump(profile, f, indent=1, sort_keys=True)
+            f.write("\n")
+
+    print("%u samples at %u Hz, %u outside 0x%08X-0x%08X" % (
+        profile["samples"], profile["rate"], profile["outside"], profile["base"],
+        profile["base"] + (profile["buckets"] << profile["shift"]) - 1))
+    if profile["samples"] == 0:
+        return 0
+
+    if opts.elf:
+        totals = attribute(profile, nm_symbols(opts.elf, opts.nm))
+    elif opts.map:
+        totals = attribute(profile, map_symbols(opts.map))
+    else:
+        totals = {"0x%08X" % (profile["base"] + (i << profile["shift"])): c
+                  for i, c in profile["counts"].items()}
+
+    ranked = sorted(totals.items(), key=lambda t: (-t[1], t[0]))
+    for name, count in ranked[:opts.top or None]:
+        print("%8u %6.2f%%  %s" % (count, count * 100.0 / profile["samples"], name))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Report the static RAM use per module from the IAR linker map.
+
+Reads the MODULE SUMMARY of the map (Linker > List > Generate linker map
+file) and prints the "rw data" of each object file, largest first, with the
+stack and heap the linker created and the headroom left in SRAM. --symbols
+also lists the largest RAM objects of the ENTRY LIST. With --port the stack
+high-water mark and the block pool use of a running device are read as well
+(see stack_monitor.h).
+
+The Debug configuration runs this after every link.
+
+Examples:
+    ram_report.py Debug/List/temperature_sensor.map
+    ram_report.py temperature_sensor.map --symbols 15 --port /dev/ttyUSB0
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+REQUEST_ID = 8
+REPORT_ID = 0x15
+SECTION_STACK = 0
+SECTION_POOL = 1
+SECTION_END = 0xFF
+SRAM_SIZE = 0x10000           # ADuCM3029 SRAM, less any bank kept for instructions or cache
+
+
+def number(text):
+    """IAR prints 10 056 and 0x0000'1a2d."""
+    text = text.replace(" ", "").replace("'", "")
+    return int(text, 0) if text else 0
+
+
+def load_modules(path):
+    """[(group, module, ro code, ro data, rw data)] of the MODULE SUMMARY."""
+    with open(path, errors="replace") as f:
+        lines = f.read().splitlines()
+    try:
+        start = next(i for i, l in enumerate(lines) if "MODULE SUMMARY" in l)
+    except StopIteration:
+        raise SystemExit("%s: no MODULE SUMMARY, is this an IAR linker map?" % path)
+
+    columns, group, modules = None, "", []
+    for line in lines[start + 1:]:
+        if line.startswith("***") and columns:
+            break
+        if columns is None:
+            # Numbers are right aligned under the column titles
+            if "Module" in line and "rw data" in line:
+                columns = [m.end() for m in re.finditer(r"ro code|ro data|rw data", line)]
+            continue
+        if not line.strip():
+            group = ""
+            continue
+        if line.strip().startswith("---"):
+            continue
+        if not line[0].isspace():
+            group = re.sub(r":( \[\d+\])?$", "", line.strip())
+            continue
+        name = re.match(r"\s*(.+?)(?:\s{2,}|$)", line)
+        if name.group(1).startswith(("Total", "Grand Total")):
+            continue
+        cells = [0, 0, 0]
+        for cell in re.finditer(r"\d+(?: \d{3})*", line[name.end(1):]):
+            end = name.end(1) + cell.end()
+            cells[min(range(3), key=lambda i: abs(columns[i] - end))] = number(cell.group())
+        modules.append((group, name.group(1), cells[0], cells[1], cells[2]))
+    return modules
+
+
+def load_symbols(path):
+    """[(size, name, module)] of the Data entries of the ENTRY LIST."""
+    with open(path, errors="replace") as f:
+        text = f.read().replace("'", "")
+    # Long names put the address on the next line
+    text = re.sub(r"\n(?=\s+0x)", " ", text)
+    entry = re.compile(r"^\s*([A-Za-z_$?][\w$?.:~<>]*)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+Data\s+\w+\s+(\S+)", re.M)
+    return [(int(size, 16), name, module) for name, addr, size, module in entry.findall(text)
+            if int(addr, 16) >= 0x20000000]
+
+
+def query_memory(port, baud, timeout):
+    """(size, peak, current), [(name, block size, blocks, in use, peak, refused)], None without an END frame."""
+    import serial
+    from stats_query import FRAME_SYNC, frames
+
+    link = serial.Serial(port, baud, timeout=0.1)
+    link.write(bytes([FRAME_SYNC, REQUEST_ID, 0]))
+    stack, pools = None, []
+    for frame_id, payload in frames(link, timeout):
+        if frame_id != REPORT_ID or not payload:
+            continue
+        if payload[0] == SECTION_STACK and len(payload) == 13:
+            stack = struct.unpack(">III", payload[1:])
+        elif payload[0] == SECTION_POOL and len(payload) >= 13:
+            pools.append((payload[13:].decode("ascii", "replace"),) + struct.unpack(">HHHHI", payload[1:13]))
+        elif payload[0] == SECTION_END:
+            return stack, pools
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("map", help="IAR linker map file")
+    parser.add_argument("--sram", type=lambda s: int(s, 0), default=SRAM_SIZE, help="RAM for data, in bytes")
+    parser.add_argument("--symbols", type=int, default=0, metavar="N", help="also list the N largest RAM objects")
+    parser.add_argument("--port", help="also read the stack and pool use of the device")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--timeout", type=float, default=2.0)
+    opts = parser.parse_args()
+
+    modules = [m for m in load_modules(opts.map) if m[4]]
+    created = sum(m[4] for m in modules if m[1] == "Linker created")
+    total = sum(m[4] for m in modules)
+
+    print("%-28s %-14s %8s" % ("module", "library", "rw data"))
+    for group, name, _, _, rw in sorted(modules, key=lambda m: (-m[4], m[1])):
+        print("%-28s %-14s %8u" % (name, re.split(r"[\\/]", group)[-1], rw))
+    print("%-28s %-14s %8u  (%u stack and heap)" % ("total", "", total, created))
+    print("%-28s %-14s %8d  of %u" % ("free", "", opts.sram - total, opts.sram))
+
+    if opts.symbols:
+        print()
+        for size, name, module in sorted(load_symbols(opts.map), reverse=True)[:opts.symbols]:
+            print("%8u  %-32s %s" % (size, name, module))
+
+    if opts.port:
+        report = query_memory(opts.port, opts.baud, opts.timeout)
+        if report is None or report[0] is None:
+            sys.stderr.write("no memory report, is the device running?\n")
+            return 1
+        (size, peak, current), pools = report
+        print("\nstack %u bytes, peak %u (%.0f%%), now %u, headroom %u" % (
+            size, peak, peak * 100.0 / size if size else 0.0, current, size - peak))
+        for name, block, count, used, most, refused in pools:
+            print("pool %-12s %4u x %4u bytes, in use %u, peak %u, refused %u%s" % (
+                name, count, block, used, most, refused, "  EXHAUSTED" if refused else ""))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Query the driver counters of a running temperature sensor.
+
+Sends a driver statistics REQUEST frame (see driver_stats.h) and prints the
+report. The firmware must be built with ADI_CFG_ENABLE_STATS set to 1,
+otherwise only the END frame comes back.
+
+Examples:
+    stats_query.py --port /dev/ttyUSB0
+    stats_query.py --port /dev/ttyUSB0 --section i2c --reset
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import time
+
+import serial
+
+FRAME_SYNC = 0x7E
+REQUEST_ID = 10
+REPORT_ID = 0x13
+FLAG_RESET = 0x01
+
+SECTIONS = {"all": 0, "uart": 1, "spi": 2, "i2c": 3, "dma": 4, "isr": 5}
+SECTION_END = 0xFF
+SECTION_STRUCTS = {1: "ADI_STATS_UART", 2: "ADI_STATS_SPI", 3: "ADI_STATS_I2C",
+                   4: "ADI_STATS_DMA", 5: "ADI_STATS_ISR"}
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+STATS_HEADER = os.path.join(ROOT, "inc", "services", "stats", "adi_stats.h")
+DEVICE_HEADER = os.path.join(ROOT, "inc", "ADuCM302x_device.h")
+
+
+def load_fields(path):
+    """Counter names of each ADI_STATS_xxx block, in report order."""
+    with open(path) as f:
+        text = f.read()
+    fields = {}
+    for body, name in re.findall(r"typedef struct\s*\{([^}]*)\}\s*(ADI_STATS_\w+);", text):
+        fields[name] = re.findall(r"uint32_t\s+(\w+);", body)
+    return fields
+
+
+def load_irqs(path):
+    with open(path) as f:
+        return {int(irq): name for name, irq in
+                re.findall(r"^\s*(\w+)_IRQn\s*=\s*(\d+)", f.read(), re.M)}
+
+
+def frames(port, timeout):
+    """Yield (id, payload) until nothing arrives for timeout seconds."""
+    buf = bytearray()
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        chunk = port.read(256)
+        if chunk:
+            buf += chunk
+            deadline = time.time() + timeout
+        while True:
+            start = buf.find(FRAME_SYNC)
+            if start < 0:
+                del buf[:]
+                break
+            del buf[:start]
+            if len(buf) < 3 or len(buf) < 3 + buf[2]:
+                break
+            yield buf[1], bytes(buf[3:3 + buf[2]])
+            del buf[:3 + buf[2]]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", required=True)
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--section", choices=sorted(SECTIONS), default="all")
+    parser.add_argument("--reset", action="store_true", help="restart the counters after reading")
+    parser.add_argument("--clock", type=float, default=26e6, help="HCLK in Hz, for the ISR times")
+    parser.add_argument("--timeout", type=float, default=2.0)
+    opts = parser.parse_args()
+
+    fields = load_fields(STATS_HEADER)
+    irqs = load_irqs(DEVICE_HEADER)
+    port = serial.Serial(opts.port, opts.baud, timeout=0.1)
+    port.write(bytes([FRAME_SYNC, REQUEST_ID, 2, SECTIONS[opts.section],
+                      FLAG_RESET if opts.reset else 0]))
+
+    for frame_id, payload in frames(port, opts.timeout):
+        if frame_id != REPORT_ID or len(payload) < 2:
+            continue
+        section, index = payload[0], payload[1]
+        words = struct.unpack(">%dI" % ((len(payload) - 2) // 4), payload[2:])
+        if section == SECTION_END:
+            return 0
+
+        name = SECTION_STRUCTS.get(section, "section %u" % section)
+        if section == SECTIONS["isr"]:
+            calls, cycles, worst, best = words[:4]
+            print("%-22s calls %10u  total %10.1f us  min %8.2f us  mean %8.2f us  max %8.2f us" % (
+                irqs.get(index, "IRQ%u" % index), calls, cycles * 1e6 / opts.clock,
+                best * 1e6 / opts.clock, (cycles * 1e6 / opts.clock) / calls if calls else 0.0,
+                worst * 1e6 / opts.clock))
+            continue
+        label = name[len("ADI_STATS_"):] if name.startswith("ADI_STATS_") else name
+        if section in (SECTIONS["spi"], SECTIONS["dma"]):
+            label += "[%u]" % index
+        print(label + ": " + ", ".join("%s %u" % (f[1:], w)
+                                       for f, w in zip(fields.get(name, []), words)))
+
+    sys.stderr.write("no END frame, is the device running?\n")
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""Turn a dump of adi_trace_Buffer into a Chrome trace timeline.
+
+Build with ADI_CFG_ENABLE_TRACE set to 1 in adi_global_config.h, stop at the
+point of interest (or call adi_trace_Stop()) and save sizeof(adi_trace_Buffer)
+bytes from &adi_trace_Buffer with the debugger, as raw binary or Intel HEX.
+
+Examples:
+    trace_decode.py trace.bin -o trace.json     # open in chrome://tracing or Perfetto
+    trace_decode.py trace.hex --text            # one line per record
+
+Interrupt handlers are drawn on the "interrupts" track, nested handlers stack
+as they did on the core. Application phases (ADI_TRACE_APP_BEGIN/END) are
+drawn on the "main" track and driver events as instants on the track of the
+context that recorded them.
+
+The clock governor records ADI_TRACE_CLOCK_DIV when it changes HCLK, the
+cycle counts after it are scaled with the root clock (--root) divided by the
+recorded divider. Counts before the first one use the HCLK of the dump.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+TRACE_MAGIC = 0x45435254
+HEADER = struct.Struct("<5I")
+RECORD = struct.Struct("<IHH")
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+TRACE_HEADER = os.path.join(ROOT, "inc", "services", "trace", "adi_trace.h")
+DEVICE_HEADER = os.path.join(ROOT, "inc", "ADuCM302x_device.h")
+
+CORE_EXCEPTIONS = {2: "NMI", 3: "HardFault", 4: "MemManage", 5: "BusFault",
+                   6: "UsageFault", 11: "SVCall", 14: "PendSV", 15: "SysTick"}
+
+MAIN_TID = 0
+ISR_TID = 1
+
+
+def load_events(path):
+    """Event names in enum order from adi_trace.h."""
+    with open(path) as f:
+        text = f.read()
+    body = re.search(r"typedef enum\s*\{(.*?)\}\s*ADI_TRACE_EVENT;", text, re.S).group(1)
+    return re.findall(r"^\s*(ADI_TRACE_\w+)\s*,", body, re.M)
+
+
+def load_irqs(path):
+    """Exception number -> name, from the IRQn enum of the device header."""
+    names = dict(CORE_EXCEPTIONS)
+    with open(path) as f:
+        for name, irq in re.findall(r"^\s*(\w+)_IRQn\s*=\s*(\d+)", f.read(), re.M):
+            names[int(irq) + 16] = name
+    return names
+
+
+def read_dump(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:1] != b":":
+        return data
+
+    # Intel HEX, assumed contiguous from the lowest address
+    image = {}
+    base = 0
+    for line in data.decode("ascii").split():
+        raw = bytes.fromhex(line[1:])
+        count, addr, kind = raw[0], (raw[1] << 8) | raw[2], raw[3]
+        if kind == 0:
+            for i in range(count):
+                image[base + addr + i] = raw[4 + i]
+        elif kind == 2:
+            base = ((raw[4] << 8) | raw[5]) << 4
+        elif kind == 4:
+            base = ((raw[4] << 8) | raw[5]) << 16
+    start = min(image)
+    return bytes(image.get(a, 0) for a in range(start, max(image) + 1))
+
+
+def records(dump):
+    """Yield (cycles, event, arg) oldest first, plus HCLK."""
+    magic, size, written, clock, _enabled = HEADER.unpack_from(dump)
+    if magic != TRACE_MAGIC:
+        raise SystemExit("not a trace buffer (magic 0x%08X), dump from &adi_trace_Buffer" % magic)
+    if HEADER.size + size * RECORD.size > len(dump):
+        raise SystemExit("dump too short, save %u bytes" % (HEADER.size + size * RECORD.size))
+
+    if written > size:
+        first, count = written % size, size
+    else:
+        first, count = 0, written
+    out = []
+    for n in range(count):
+        out.append(RECORD.unpack_from(dump, HEADER.size + ((first + n) % size) * RECORD.size))
+    return out, clock, written - count
+
+
+def microseconds(recs, events, clock, root):
+    """Time of each record in us from the first one, gaps under 2^32 cycles."""
+    out = []
+    now = 0.0
+    last = None
+    hclk = clock
+    for cycles, event, arg in recs:
+        if last is not None:
+            now += ((cycles - last) & 0xFFFFFFFF) * 1e6 / hclk
+        last = cycles
+        out.append(now)
+        if event < len(events) and events[event] == "ADI_TRACE_CLOCK_DIV" and arg:
+            hclk = root / arg
+    return out
+
+
+def timeline(recs, events, irqs, stamps):
+    """Chrome trace events at the record times of microseconds()."""
+    out = [{"ph": "M", "name": "thread_name", "pid": 0, "tid": MAIN_TID, "args": {"name": "main"}},
+           {"ph": "M", "name": "thread_name", "pid": 0, "tid": ISR_TID, "args": {"name": "interrupts"}}]
+    isr_stack = []
+    app_open = {}
+
+    for (_cycles, event, arg), ts in zip(recs, stamps):
+        name = events[event] if event < len(events) else "EVENT_%u" % event
+
+        if name == "ADI_TRACE_ISR_BEGIN":
+            isr_stack.append(arg)
+            out.append({"ph": "B", "name": irqs.get(arg, "IRQ%u" % arg), "cat": "isr",
+                        "pid": 0, "tid": ISR_TID, "ts": ts})
+        elif name == "ADI_TRACE_ISR_END":
+            # the buffer may start inside a handler, drop its unmatched exit
+            if isr_stack and isr_stack[-1] == arg:
+                isr_stack.pop()
+                out.append({"ph": "E", "pid": 0, "tid": ISR_TID, "ts": ts})
+        elif name == "ADI_TRACE_APP_BEGIN":
+            app_open[arg] = app_open.get(arg, 0) + 1
+            out.append({"ph": "B", "name": "phase %u" % arg, "cat": "app",
+                        "pid": 0, "tid": MAIN_TID, "ts": ts})
+        elif name == "ADI_TRACE_APP_END":
+            if app_open.get(arg, 0) > 0:
+                app_open[arg] -= 1
+                out.append({"ph": "E", "pid": 0, "tid": MAIN_TID, "ts": ts})
+        else:
+            out.append({"ph": "i", "s": "t", "name": name[len("ADI_TRACE_"):],
+                        "cat": "driver", "pid": 0, "tid": ISR_TID if isr_stack else MAIN_TID,
+                        "ts": ts, "args": {"arg": "0x%04X" % arg}})
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump", help="adi_trace_Buffer as raw binary or Intel HEX")
+    parser.add_argument("-o", "--output", help="Chrome trace JSON, default stdout")
+    parser.add_argument("--text", action="store_true", help="list the records instead")
+    parser.add_argument("--clock", type=float, help="HCLK in Hz, default the recorded one")
+    parser.add_argument("--root", type=float, default=26e6,
+                        help="root clock in Hz the ADI_TRACE_CLOCK_DIV dividers apply to")
+    opts = parser.parse_args()
+
+    events = load_events(TRACE_HEADER)
+    irqs = load_irqs(DEVICE_HEADER)
+    recs, clock, lost = records(read_dump(opts.dump))
+    clock = opts.clock or clock or 26e6
+    sys.stderr.write("%u records, %u overwritten, HCLK %.0f Hz\n" % (len(recs), lost, clock))
+    stamps = microseconds(recs, events, clock, opts.root)
+
+    out = open(opts.output, "w") if opts.output else sys.stdout
+    if opts.text:
+        for (_cycles, event, arg), ts in zip(recs, stamps):
+            name = events[event] if event < len(events) else "EVENT_%u" % event
+            if name.startswith("ADI_TRACE_ISR_"):
+                detail = irqs.get(arg, "IRQ%u" % arg)
+            else:
+                detail = "0x%04X" % arg
+            out.write("%12.3f us  %-26s %s\n" % (ts, name, detail))
+    else:
+        json.dump({"traceEvents": timeline(recs, events, irqs, stamps),
+                   "displayTimeUnit": "ns"}, out)
+        out.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,277 @@
+
+#include <stddef.h>
+#include <string.h>
+#include <adi_processor.h>
+
+#include "transport.h"
+#include "packetizer.h"
+#include "clock_governor.h"
+#include "idle_manager.h"
+
+/*
+ * Sliding window sender. Transport_Send and Transport_Poll run in the main
+ * loop and own the window, Transport_OnAck runs from the UART interrupt and
+ * only publishes the latest ACK as one 32 bit word, so the two sides never
+ * write the same variable and no critical region is needed.
+ */
+
+#define FRAME_HEADER_SIZE   3u          //SYNC, ID, LENGTH
+#define SEQ_SIZE            2u          //sequence number in a DATA frame
+#define ACK_MASK_BITS       16u         //frames after the cumulative ACK covered by the mask
+
+#if (((TRANSPORT_WINDOW) & ((TRANSPORT_WINDOW) - 1)) != 0) || ((TRANSPORT_WINDOW) > 17)
+#error "TRANSPORT_WINDOW must be a power of two no larger than 17"
+#endif
+
+//DATA frame kept until it is acknowledged
+typedef struct
+{
+  uint32_t SentAt;                    //ClockGov_Cycles of the last transmission
+  bool_t   Sacked;                    //reported received by the ACK mask
+  bool_t   FastResent;                //resent for a gap since the last timeout, later ACKs leave it alone
+  uint8_t  Length;                    //frame bytes
+  uint8_t  Frame[FRAME_HEADER_SIZE + SEQ_SIZE + TRANSPORT_MAX_DATA];
+} RETAINED_FRAME;
+
+static RETAINED_FRAME    Retained[TRANSPORT_WINDOW];//frames in flight, indexed by sequence number
+static uint16_t          NextSeq;//sequence number of the next DATA frame
+static uint16_t          BaseSeq;//oldest unacknowledged sequence number
+static uint32_t          RtoCycles;//retransmit timeout in root clock cycles
+static uint32_t          LastAck;//ACK word processed by Transport_Poll
+static volatile uint32_t AckWord;//latest ACK, next expected sequence << 16 | received mask
+static TRANSPORT_STATS   Stats;//transport counters
+
+
+/********************************************************************
+* Send a retained frame again                                        *
+*********************************************************************/
+static void Resend(RETAINED_FRAME *_frame)
+{
+  _frame->SentAt = ClockGov_Cycles();
+  Packetizer_Write(_frame->Frame, _frame->Length);
+  Stats.Resent++;
+}
+
+
+/********************************************************************
+* Apply a new ACK word to the window                                 *
+*********************************************************************/
+static void ProcessAck(uint32_t _ack)
+{
+  uint16_t cum = (uint16_t)(_ack >> 16);
+  uint16_t mask = (uint16_t)_ack;
+  uint16_t inFlight = (uint16_t)(NextSeq - BaseSeq);
+  uint16_t acked = (uint16_t)(cum - BaseSeq);
+  uint16_t highest = 0u;
+  uint16_t offset;
+  uint16_t seq;
+
+  //stale or bogus ACK
+  if(acked > inFlight)
+    return;
+
+  Stats.Acked += acked;
+  BaseSeq = cum;
+
+  //frames the host already holds past the gap
+  for(seq = (uint16_t)(BaseSeq + 1u); seq != NextSeq; seq++)
+  {
+    offset = (uint16_t)(seq - BaseSeq);
+    if((offset <= ACK_MASK_BITS) && ((mask & (1u << (offset - 1u))) != 0u))
+    {
+      Retained[seq & (TRANSPORT_WINDOW - 1u)].Sacked = true;
+      highest = offset;
+    }
+  }
+
+  //a later frame arrived, so the missing ones before it are lost: resend them now,
+  //once, every following ACK reports the same gap until the resend gets there
+  for(offset = 0u; offset < highest; offset++)
+  {
+    RETAINED_FRAME *pFrame = &Retained[(uint16_t)(BaseSeq + offset) & (TRANSPORT_WINDOW - 1u)];
+    if(!pFrame->Sacked && !pFrame->FastResent)
+    {
+      pFrame->FastResent = true;
+      Resend(pFrame);
+    }
+  }
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_Init
+* Description  : This function empties the window, restarts the sequence numbers at 0 and
+*                sends a HELLO frame carrying the device UID and the window size
+* Arguments    : uint8_t const* _uid = TRANSPORT_UID_LENGTH bytes of device UID
+* Return Value : 0 = Success
+*                1 = Failure (HELLO not written)
+**********************************************************************************************/
+unsigned char Transport_Init(uint8_t const * _uid)
+{
+  uint8_t hello[FRAME_HEADER_SIZE + TRANSPORT_UID_LENGTH + 1u];
+
+  //the timebase keeps its rate across the clock governor levels
+  RtoCycles = (CLOCK_GOV_ROOT_HZ / 1000u) * TRANSPORT_RTO_MS;
+
+  NextSeq = 0u;
+  BaseSeq = 0u;
+  AckWord = 0u;
+  LastAck = 0u;
+  memset(&Stats, 0, sizeof(Stats));
+
+  hello[0] = CMD_FRAME_SYNC;
+  hello[1] = TRANSPORT_HELLO_ID;
+  hello[2] = TRANSPORT_UID_LENGTH + 1u;
+  memcpy(&hello[FRAME_HEADER_SIZE], _uid, TRANSPORT_UID_LENGTH);
+  hello[FRAME_HEADER_SIZE + TRANSPORT_UID_LENGTH] = TRANSPORT_WINDOW;
+
+  //announce the device straight away
+  if(Packetizer_Write(hello, sizeof(hello)) != 0)
+    return 1;
+  return Packetizer_Flush();
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_Send
+* Description  : This function sends _data in the next DATA frame and keeps the frame until
+*                the host acknowledges it. It does not wait for the ACK. A frame that could
+*                not be written is sent again after TRANSPORT_RTO_MS.
+* Arguments    : uint8_t const* _data = application data
+*                uint8_t _length = bytes of data, at most TRANSPORT_MAX_DATA
+* Return Value : 0 = Success
+*                1 = Failure (window full or data too long, nothing sent)
+**********************************************************************************************/
+unsigned char Transport_Send(uint8_t const * _data, uint8_t _length)
+{
+  RETAINED_FRAME *pFrame;
+
+  if(_length > TRANSPORT_MAX_DATA)
+    return 1;
+
+  Transport_Poll();
+
+  if((uint16_t)(NextSeq - BaseSeq) >= TRANSPORT_WINDOW)
+  {
+    Stats.WindowFull++;
+    return 1;
+  }
+
+  pFrame = &Retained[NextSeq & (TRANSPORT_WINDOW - 1u)];
+  pFrame->Frame[0] = CMD_FRAME_SYNC;
+  pFrame->Frame[1] = TRANSPORT_DATA_ID;
+  pFrame->Frame[2] = (uint8_t)(SEQ_SIZE + _length);
+  pFrame->Frame[3] = (uint8_t)(NextSeq >> 8);
+  pFrame->Frame[4] = (uint8_t)NextSeq;
+  memcpy(&pFrame->Frame[FRAME_HEADER_SIZE + SEQ_SIZE], _data, _length);
+  pFrame->Length = (uint8_t)(FRAME_HEADER_SIZE + SEQ_SIZE + _length);
+  pFrame->Sacked = false;
+  pFrame->FastResent = false;
+  pFrame->SentAt = ClockGov_Cycles();
+
+  NextSeq++;
+  Stats.Sent++;
+  Packetizer_Write(pFrame->Frame, pFrame->Length);
+
+  return 0;
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_Poll
+* Description  : This function applies the latest ACK from the host, resending the gaps it
+*                reports, and resends every frame unacknowledged for TRANSPORT_RTO_MS.
+*                Call it regularly from the main loop, Transport_Send also calls it.
+* Arguments    : void
+* Return Value : void
+**********************************************************************************************/
+void Transport_Poll(void)
+{
+  uint32_t ack = AckWord;
+  uint32_t now;
+  uint16_t seq;
+
+  if(ack != LastAck)
+  {
+    LastAck = ack;
+    ProcessAck(ack);
+  }
+
+  now = ClockGov_Cycles();
+  for(seq = BaseSeq; seq != NextSeq; seq++)
+  {
+    RETAINED_FRAME *pFrame = &Retained[seq & (TRANSPORT_WINDOW - 1u)];
+    if(!pFrame->Sacked && ((now - pFrame->SentAt) >= RtoCycles))
+    {
+      //the resend was lost too, let the next gap report fast resend it again
+      pFrame->FastResent = false;
+      Resend(pFrame);
+    }
+  }
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_NextTimeout
+* Description  : This function returns the time until Transport_Poll resends the next frame
+*                for TRANSPORT_RTO_MS, to bound a low power wait
+* Arguments    : void
+* Return Value : time in ms, IDLE_FOREVER when no frame waits for an ACK
+**********************************************************************************************/
+uint32_t Transport_NextTimeout(void)
+{
+  uint32_t next = IDLE_FOREVER;
+  uint32_t ms;
+  uint16_t seq;
+
+  for(seq = BaseSeq; seq != NextSeq; seq++)
+  {
+    RETAINED_FRAME *pFrame = &Retained[seq & (TRANSPORT_WINDOW - 1u)];
+    if(pFrame->Sacked)
+      continue;
+
+    ms = ClockGov_MsUntil(pFrame->SentAt + RtoCycles);
+    if(ms < next)
+      next = ms;
+  }
+  return next;
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_OnAck
+* Description  : Command handler for TRANSPORT_ACK_ID frames, see TRANSPORT_ACK_ENTRY. Only
+*                records the ACK, the window is updated by Transport_Poll.
+* Arguments    : uint8_t const* _payload = next expected sequence and received mask, MSB first
+*                uint8_t _length = 4
+* Return Value : void
+**********************************************************************************************/
+void Transport_OnAck(uint8_t const * _payload, uint8_t _length)
+{
+  AckWord = ((uint32_t)_payload[0] << 24) | ((uint32_t)_payload[1] << 16) |
+            ((uint32_t)_payload[2] << 8) | (uint32_t)_payload[3];
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_InFlight
+* Description  : This function returns the number of DATA frames waiting for an ACK
+* Arguments    : void
+* Return Value : frames in flight
+**********************************************************************************************/
+uint32_t Transport_InFlight(void)
+{
+  return (uint16_t)(NextSeq - BaseSeq);
+}
+
+
+/**********************************************************************************************
+* Function Name: Transport_GetStats
+* Description  : This function returns the transport counters since Transport_Init
+* Arguments    : void
+* Return Value : transport counters
+**********************************************************************************************/
+TRANSPORT_STATS const* Transport_GetStats(void)
+{
+  return &Stats;
+}
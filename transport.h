@@ -0,0 +1,91 @@
+
+#ifndef _TRANSPORT_H_
+#define _TRANSPORT_H_
+
+/******************************************************************************/
+/* Include Files                                                              */
+/******************************************************************************/
+
+#include "adi_types.h"
+#include "command_parser.h"
+
+
+/******************************************************************************/
+/* transport parameters                                                       */
+/******************************************************************************/
+
+/*
+ * Reliable device to host transport over the command frame format of
+ * command_parser.h (SYNC, ID, LENGTH, PAYLOAD).
+ *
+ * Device to host:
+ *   HELLO  payload = UID[TRANSPORT_UID_LENGTH], window size
+ *   DATA   payload = sequence number (MSB first), application data
+ *
+ * Host to device:
+ *   ACK    payload = next expected sequence number (MSB first),
+ *                    received mask (MSB first, bit n = sequence ack + 1 + n arrived)
+ *
+ * Up to TRANSPORT_WINDOW frames are in flight without waiting for the host.
+ * The ACK is cumulative, a gap reported by the received mask is resent
+ * straight away and a frame that stays unacknowledged for TRANSPORT_RTO_MS
+ * is resent from the retained ring. Frames are written through the
+ * packetizer, TRANSPORT_RTO_MS must stay well above its age limit.
+ */
+#define TRANSPORT_UID_LENGTH    20       //bytes of the device UID
+#define TRANSPORT_WINDOW        8        //frames in flight, MUST BE A POWER OF TWO, at most 17
+#define TRANSPORT_MAX_DATA      16       //largest application payload per frame
+#define TRANSPORT_RTO_MS        1000     //retransmit timeout
+
+//frame IDs
+#define TRANSPORT_HELLO_ID      0x10     //device to host
+#define TRANSPORT_DATA_ID       0x11     //device to host
+#define TRANSPORT_ACK_ID        11       //host to device, index in the command table
+
+#if ((TRANSPORT_ACK_ID) >= (CMD_TABLE_SIZE))
+#error "TRANSPORT_ACK_ID must be a valid command table index"
+#endif
+
+//command table entry for the ACK frame
+#define TRANSPORT_ACK_ENTRY     { Transport_OnAck, 4, 4 }
+
+
+/******************************************************************************/
+/* Types                                                                      */
+/******************************************************************************/
+
+typedef struct
+{
+  uint32_t Sent;                      //DATA frames sent the first time
+  uint32_t Resent;                    //DATA frames sent again
+  uint32_t Acked;                     //DATA frames acknowledged
+  uint32_t WindowFull;                //Transport_Send calls refused by a full window
+} TRANSPORT_STATS;
+
+
+/******************************************************************************/
+/* Function Prototypes                                                       */
+/******************************************************************************/
+
+//reset the sequence numbers and announce the device UID
+unsigned char Transport_Init(uint8_t const * _uid);
+
+//send application data, returns 1 while the window is full
+unsigned char Transport_Send(uint8_t const * _data, uint8_t _length);
+
+//release acknowledged frames and resend lost ones
+void Transport_Poll(void);
+
+//ms until the next resend, IDLE_FOREVER if none
+uint32_t Transport_NextTimeout(void);
+
+//ACK frame handler, called by the command parser
+void Transport_OnAck(uint8_t const * _payload, uint8_t _length);
+
+//frames in flight
+uint32_t Transport_InFlight(void);
+
+//transport counters
+TRANSPORT_STATS const* Transport_GetStats(void);
+
+#endif /* _TRANSPORT_H_ */